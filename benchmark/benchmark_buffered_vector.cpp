@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <cslibs_utility/buffered/buffered_vector.hpp>
+#include <cslibs_utility/buffered/static_buffered_vector.hpp>
+
+namespace {
+struct Particle {
+  double x;
+  double y;
+  double yaw;
+  double weight;
+};
+
+constexpr std::size_t capacity = 4096;
+
+/**
+ * A particle set refilled every cycle, as done by a filter's resampling.
+ * std::vector is constructed per cycle, the buffered vectors are reused.
+ */
+void BM_VectorPerCycle(benchmark::State &state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    std::vector<Particle> particles;
+    particles.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      particles.push_back(Particle{1.0 * i, 2.0, 3.0, 1.0});
+    }
+    benchmark::DoNotOptimize(particles.data());
+  }
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+void BM_VectorReuse(benchmark::State &state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  std::vector<Particle> particles;
+  for (auto _ : state) {
+    particles.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+      particles.push_back(Particle{1.0 * i, 2.0, 3.0, 1.0});
+    }
+    benchmark::DoNotOptimize(particles.data());
+  }
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+void BM_BufferedVectorReuse(benchmark::State &state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  cslibs_utility::buffered::buffered_vector<Particle> particles(0, capacity);
+  for (auto _ : state) {
+    particles.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+      particles.emplace_back(Particle{1.0 * i, 2.0, 3.0, 1.0});
+    }
+    benchmark::DoNotOptimize(particles.data());
+  }
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+void BM_StaticBufferedVectorReuse(benchmark::State &state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  static cslibs_utility::buffered::static_buffered_vector<Particle, capacity>
+      particles;
+  for (auto _ : state) {
+    particles.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+      particles.emplace_back(Particle{1.0 * i, 2.0, 3.0, 1.0});
+    }
+    benchmark::DoNotOptimize(particles.data());
+  }
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_VectorPerCycle)->RangeMultiplier(8)->Range(64, capacity);
+BENCHMARK(BM_VectorReuse)->RangeMultiplier(8)->Range(64, capacity);
+BENCHMARK(BM_BufferedVectorReuse)->RangeMultiplier(8)->Range(64, capacity);
+BENCHMARK(BM_StaticBufferedVectorReuse)->RangeMultiplier(8)->Range(64, capacity);
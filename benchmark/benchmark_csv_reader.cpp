@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <cslibs_utility/logger/csv_column_reader.hpp>
+#include <cslibs_utility/logger/csv_formatter.hpp>
+#include <cslibs_utility/logger/csv_reader.hpp>
+
+namespace {
+using cslibs_utility::logger::CSVReadMode;
+using reader_t = cslibs_utility::logger::CSVReader<long, double, double, int>;
+using column_reader_t =
+    cslibs_utility::logger::CSVColumnReader<long, double, double, int>;
+
+const std::string path = "/tmp/cslibs_utility_benchmark_reader.csv";
+constexpr int rows = 1 << 18;
+
+std::int64_t file_size = 0;
+
+void Setup(const benchmark::State &) {
+  if (file_size > 0) {
+    return;
+  }
+  std::string buffer = "stamp,x,y,id\n";
+  for (int i = 0; i < rows; ++i) {
+    cslibs_utility::logger::CSVFormatter<long, double, double, int>::formatRow(
+        buffer, 1600000000000L + i, 0.001 * i, -1.5 * i, i % 100);
+  }
+  std::ofstream out(path, std::ios::binary);
+  out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  file_size = static_cast<std::int64_t>(buffer.size());
+}
+
+void BM_CSVReader(benchmark::State &state) {
+  const CSVReadMode mode = static_cast<CSVReadMode>(state.range(0));
+  for (auto _ : state) {
+    reader_t reader(path, true, mode, 4);
+    benchmark::DoNotOptimize(reader.getData().data());
+  }
+  state.SetBytesProcessed(file_size * state.iterations());
+  state.SetItemsProcessed(rows * state.iterations());
+}
+
+void BM_CSVColumnReader(benchmark::State &state) {
+  for (auto _ : state) {
+    column_reader_t reader(path, true, static_cast<std::size_t>(state.range(0)));
+    benchmark::DoNotOptimize(reader.getColumn<0>().data());
+  }
+  state.SetBytesProcessed(file_size * state.iterations());
+  state.SetItemsProcessed(rows * state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_CSVReader)
+    ->Setup(Setup)
+    ->ArgName("mode")
+    ->Arg(static_cast<int>(CSVReadMode::Stream))
+    ->Arg(static_cast<int>(CSVReadMode::Mapped))
+    ->Arg(static_cast<int>(CSVReadMode::Parallel))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_CSVColumnReader)
+    ->Setup(Setup)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
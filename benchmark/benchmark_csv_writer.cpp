@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <queue>
+
+#include <cslibs_utility/logger/csv_writer.hpp>
+
+namespace {
+using row_t = std::tuple<int, double, double, double, long>;
+
+/**
+ * @brief The QueueWriter class mirrors the former CSVWriter pipeline, one
+ *        string per row is queued and written separately, and serves as
+ *        baseline for the batched writer.
+ */
+class QueueWriter {
+ public:
+  explicit QueueWriter(const std::string &path) : path_(path), stop_(false) {
+    worker_thread_ = std::thread([this] { loop(); });
+  }
+
+  ~QueueWriter() {
+    stop_ = true;
+    notify_log_.notify_one();
+    worker_thread_.join();
+  }
+
+  void write(const int a, const double b, const double c, const double d,
+             const long e) {
+    std::string row;
+    cslibs_utility::logger::CSVFormatter<int, double, double, double,
+                                         long>::format(row, a, b, c, d, e);
+    std::unique_lock<std::mutex> q_lock(q_mutex_);
+    q_.push(row);
+    notify_log_.notify_one();
+  }
+
+ private:
+  std::ofstream out_;
+  std::string path_;
+  std::thread worker_thread_;
+  std::mutex q_mutex_;
+  std::queue<std::string> q_;
+  std::mutex notify_mutex_;
+  std::condition_variable notify_log_;
+  std::atomic_bool stop_;
+
+  void loop() {
+    out_.open(path_);
+    auto dumpQ = [this]() {
+      std::unique_lock<std::mutex> q_lock(q_mutex_);
+      while (!q_.empty()) {
+        auto f = q_.front();
+        q_.pop();
+        q_lock.unlock();
+        out_ << f << "\n";
+        q_lock.lock();
+      }
+    };
+    std::unique_lock<std::mutex> notify_lock(notify_mutex_);
+    while (!stop_) {
+      notify_log_.wait_for(notify_lock, std::chrono::milliseconds(10));
+      dumpQ();
+    }
+    dumpQ();
+  }
+};
+
+template <typename writer_t>
+void writeRows(benchmark::State &state, writer_t &writer) {
+  int i = state.thread_index();
+  for (auto _ : state) {
+    writer.write(i, 0.25 * i, 1.5 * i, -3.75 * i, 1000000L + i);
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+std::unique_ptr<QueueWriter> queue_writer;
+void BM_QueueWriter(benchmark::State &state) { writeRows(state, *queue_writer); }
+BENCHMARK(BM_QueueWriter)
+    ->Setup([](const benchmark::State &) {
+      queue_writer.reset(new QueueWriter("/tmp/cslibs_utility_bm_queue.csv"));
+    })
+    ->Teardown([](const benchmark::State &) { queue_writer.reset(); })
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
+
+using csv_writer_t =
+    cslibs_utility::logger::CSVWriter<int, double, double, double, long>;
+std::unique_ptr<csv_writer_t> csv_writer;
+void BM_CSVWriter(benchmark::State &state) { writeRows(state, *csv_writer); }
+BENCHMARK(BM_CSVWriter)
+    ->Setup([](const benchmark::State &state) {
+      csv_writer_t::options_t options;
+      options.batch_size = static_cast<std::size_t>(state.range(0));
+      csv_writer.reset(
+          new csv_writer_t("/tmp/cslibs_utility_bm_csv_writer.csv", options));
+    })
+    ->Teardown([](const benchmark::State &) { csv_writer.reset(); })
+    ->ArgName("batch_size")
+    ->Arg(64)
+    ->Arg(1024)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+#include <cslibs_utility/common/delegate.hpp>
+#include <cslibs_utility/common/unique_delegate.hpp>
+
+namespace {
+using signature_t = int(int);
+
+/**
+ * @brief Lambda capturing two pointers, small enough for inline storage.
+ */
+auto makeFunctor(int &a, int &b) {
+  return [pa = &a, pb = &b](int i) { return *pa + *pb + i; };
+}
+
+template <typename Function>
+void BM_Construct(benchmark::State &state) {
+  int a = 1, b = 2;
+  for (auto _ : state) {
+    Function f(makeFunctor(a, b));
+    benchmark::DoNotOptimize(f);
+  }
+}
+
+template <typename Function>
+void BM_Copy(benchmark::State &state) {
+  int a = 1, b = 2;
+  Function f(makeFunctor(a, b));
+  for (auto _ : state) {
+    Function copy(f);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+template <typename Function>
+void BM_Move(benchmark::State &state) {
+  int a = 1, b = 2;
+  Function f(makeFunctor(a, b));
+  for (auto _ : state) {
+    Function moved(std::move(f));
+    f = std::move(moved);
+    benchmark::DoNotOptimize(f);
+  }
+}
+
+template <typename Function>
+void BM_Invoke(benchmark::State &state) {
+  int a = 1, b = 2;
+  Function f(makeFunctor(a, b));
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(i = f(i));
+  }
+}
+
+using delegate_t = cslibs_utility::common::delegate<signature_t>;
+using unique_delegate_t = cslibs_utility::common::unique_delegate<signature_t>;
+using function_t = std::function<signature_t>;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Construct, delegate_t);
+BENCHMARK_TEMPLATE(BM_Construct, unique_delegate_t);
+BENCHMARK_TEMPLATE(BM_Construct, function_t);
+BENCHMARK_TEMPLATE(BM_Copy, delegate_t);
+BENCHMARK_TEMPLATE(BM_Copy, function_t);
+BENCHMARK_TEMPLATE(BM_Move, delegate_t);
+BENCHMARK_TEMPLATE(BM_Move, unique_delegate_t);
+BENCHMARK_TEMPLATE(BM_Move, function_t);
+BENCHMARK_TEMPLATE(BM_Invoke, delegate_t);
+BENCHMARK_TEMPLATE(BM_Invoke, unique_delegate_t);
+BENCHMARK_TEMPLATE(BM_Invoke, function_t);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include <cslibs_utility/synchronized/multi_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_priority_queue.hpp>
+
+namespace {
+using priority_queue_t = cslibs_utility::synchronized::priority_queue<int>;
+using multi_queue_t = cslibs_utility::synchronized::multi_queue<int>;
+
+constexpr int prefill = 1 << 14;
+constexpr int max_threads = 32;
+
+std::unique_ptr<priority_queue_t> priority_queue;
+std::unique_ptr<multi_queue_t> multi_queue;
+
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return static_cast<int>(state >> 8);
+}
+
+void SetupPriorityQueue(const benchmark::State &) {
+  priority_queue.reset(new priority_queue_t);
+  std::uint32_t state = 1;
+  for (int i = 0; i < prefill; ++i) {
+    priority_queue->emplace(nextKey(state));
+  }
+}
+
+void SetupMultiQueue(const benchmark::State &state) {
+  multi_queue.reset(new multi_queue_t(state.threads()));
+  std::uint32_t s = 1;
+  for (int i = 0; i < prefill; ++i) {
+    multi_queue->push(nextKey(s));
+  }
+}
+
+void Teardown(const benchmark::State &) {
+  priority_queue.reset();
+  multi_queue.reset();
+}
+
+/**
+ * Every iteration pushes a random key and pops the top, the queue size
+ * stays at the prefill, thus pop never runs empty.
+ */
+void BM_PriorityQueue(benchmark::State &state) {
+  std::uint32_t s = static_cast<std::uint32_t>(state.thread_index()) + 2;
+  for (auto _ : state) {
+    priority_queue->emplace(nextKey(s));
+    benchmark::DoNotOptimize(priority_queue->pop());
+  }
+  state.SetItemsProcessed(2 * state.iterations());
+}
+
+void BM_MultiQueue(benchmark::State &state) {
+  std::uint32_t s = static_cast<std::uint32_t>(state.thread_index()) + 2;
+  for (auto _ : state) {
+    multi_queue->push(nextKey(s));
+    benchmark::DoNotOptimize(multi_queue->try_pop_top());
+  }
+  state.SetItemsProcessed(2 * state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_PriorityQueue)
+    ->Setup(SetupPriorityQueue)
+    ->Teardown(Teardown)
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+BENCHMARK(BM_MultiQueue)
+    ->Setup(SetupMultiQueue)
+    ->Teardown(Teardown)
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include <cslibs_utility/synchronized/mpmc_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_queue.hpp>
+
+namespace {
+using queue_t = cslibs_utility::synchronized::queue<int>;
+using mpmc_queue_t = cslibs_utility::synchronized::mpmc_queue<int, false>;
+
+constexpr int prefill = 1024;
+constexpr int max_threads = 32;
+
+std::unique_ptr<queue_t> queue;
+std::unique_ptr<mpmc_queue_t> mpmc_queue;
+
+void SetupQueue(const benchmark::State &) {
+  queue.reset(new queue_t);
+  for (int i = 0; i < prefill; ++i) {
+    queue->push(i);
+  }
+}
+
+void SetupMPMCQueue(const benchmark::State &) {
+  mpmc_queue.reset(new mpmc_queue_t(4 * prefill));
+  for (int i = 0; i < prefill; ++i) {
+    mpmc_queue->try_push(i);
+  }
+}
+
+void Teardown(const benchmark::State &) {
+  queue.reset();
+  mpmc_queue.reset();
+}
+
+/**
+ * Every iteration pushes and pops one element, the queue size stays around
+ * the prefill, thus pop never runs empty.
+ */
+void BM_Queue(benchmark::State &state) {
+  int value = 0;
+  for (auto _ : state) {
+    queue->push(value);
+    benchmark::DoNotOptimize(queue->try_pop(value));
+  }
+  state.SetItemsProcessed(2 * state.iterations());
+}
+
+void BM_QueueBatch(benchmark::State &state) {
+  std::vector<int> values(static_cast<std::size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    queue->push_range(values.begin(), values.end());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      int value;
+      benchmark::DoNotOptimize(queue->try_pop(value));
+    }
+  }
+  state.SetItemsProcessed(2 * state.range(0) * state.iterations());
+}
+
+void BM_MPMCQueue(benchmark::State &state) {
+  int value = 0;
+  for (auto _ : state) {
+    while (!mpmc_queue->try_push(value)) {
+    }
+    benchmark::DoNotOptimize(mpmc_queue->try_pop(value));
+  }
+  state.SetItemsProcessed(2 * state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_Queue)
+    ->Setup(SetupQueue)
+    ->Teardown(Teardown)
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+BENCHMARK(BM_QueueBatch)
+    ->Setup(SetupQueue)
+    ->Teardown(Teardown)
+    ->Arg(64)
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
+BENCHMARK(BM_MPMCQueue)
+    ->Setup(SetupMPMCQueue)
+    ->Teardown(Teardown)
+    ->ThreadRange(1, max_threads)
+    ->UseRealTime();
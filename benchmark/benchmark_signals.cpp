@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <vector>
+
+#include <cslibs_utility/signals/signals.hpp>
+
+namespace {
+using signal_t = cslibs_utility::signals::Signal<std::function<void(int)>>;
+
+/**
+ * Latency of a single emission to state.range(0) slots, each slot only
+ * accumulates its argument.
+ */
+void BM_SignalEmit(benchmark::State &state) {
+  signal_t signal;
+  std::vector<signal_t::Connection::Ptr> connections;
+  long sum = 0;
+  for (int i = 0; i < state.range(0); ++i) {
+    connections.emplace_back(signal.connect([&sum](int v) { sum += v; }));
+  }
+  signal.enable();
+
+  int value = 0;
+  for (auto _ : state) {
+    signal(++value);
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+/**
+ * Baseline calling the slots directly from a vector.
+ */
+void BM_FunctionLoop(benchmark::State &state) {
+  std::vector<std::function<void(int)>> slots;
+  long sum = 0;
+  for (int i = 0; i < state.range(0); ++i) {
+    slots.emplace_back([&sum](int v) { sum += v; });
+  }
+
+  int value = 0;
+  for (auto _ : state) {
+    ++value;
+    for (const auto &s : slots) {
+      s(value);
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+/**
+ * Emissions while other threads emit concurrently, the slot list is shared.
+ */
+signal_t shared_signal;
+signal_t::Connection::Ptr shared_connection;
+
+void SetupShared(const benchmark::State &) {
+  shared_connection = shared_signal.connect([](int v) { benchmark::DoNotOptimize(v); });
+  shared_signal.enable();
+}
+
+void TeardownShared(const benchmark::State &) {
+  shared_connection.reset();
+}
+
+void BM_SignalEmitShared(benchmark::State &state) {
+  int value = 0;
+  for (auto _ : state) {
+    shared_signal(++value);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_SignalEmit)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_FunctionLoop)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_SignalEmitShared)
+    ->Setup(SetupShared)
+    ->Teardown(TeardownShared)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
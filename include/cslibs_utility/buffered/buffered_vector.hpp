@@ -1,12 +1,27 @@
 #ifndef CSLIBS_UTILITY_BUFFERED_VECTOR_HPP
 #define CSLIBS_UTILITY_BUFFERED_VECTOR_HPP
 
+#include <algorithm>
 #include <vector>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <assert.h>
 
+#include <cslibs_utility/buffered/default_init_allocator.hpp>
+
 namespace cslibs_utility {
 namespace buffered {
+/**
+ * @brief The buffered_vector class keeps its entries allocated across
+ *        clear, so refilling it each cycle does not allocate. By default the
+ *        capacity is fixed; in growable mode the capacity grows geometrically
+ *        on demand and is never released. New entries are value-initialized
+ *        unless Alloc is a default_init_allocator, see
+ *        default_init_buffered_vector.
+ */
 template<typename T, typename Alloc = std::allocator<T> >
 class buffered_vector {
 public:
@@ -16,7 +31,8 @@ public:
 
     buffered_vector() :
         size_(0),
-        data_ptr_(nullptr)
+        data_ptr_(nullptr),
+        growable_(false)
     {
     }
     /**
@@ -26,8 +42,9 @@ public:
      */
     buffered_vector(const std::size_t size) :
         size_(size),
-        data_(size_, T()),
-        data_ptr_(data_.data())
+        data_(size_),
+        data_ptr_(data_.data()),
+        growable_(false)
     {
 
     }
@@ -40,8 +57,9 @@ public:
     buffered_vector(const std::size_t size,
                     const std::size_t capacity) :
         size_(size),
-        data_(capacity, T()),
-        data_ptr_(data_.data())
+        data_(capacity),
+        data_ptr_(data_.data()),
+        growable_(false)
     {
         assert(size <= capacity);
     }
@@ -57,7 +75,26 @@ public:
                     const T &default_value) :
         size_(size),
         data_(capacity, default_value),
-        data_ptr_(data_.data())
+        data_ptr_(data_.data()),
+        growable_(false)
+    {
+        assert(size <= capacity);
+    }
+
+    /**
+     * @brief buffered_vector constructor for preferred size and capacity
+     *        using the given allocator.
+     * @param size          - preferred value <= capacity
+     * @param capacity      - the maximim capacity
+     * @param alloc         - the allocator, e.g. a memory::frame_allocator
+     */
+    buffered_vector(const std::size_t size,
+                    const std::size_t capacity,
+                    const Alloc &alloc) :
+        size_(size),
+        data_(capacity, alloc),
+        data_ptr_(data_.data()),
+        growable_(false)
     {
         assert(size <= capacity);
     }
@@ -232,7 +269,9 @@ public:
                        const T default_value = T())
     {
         size_ = 0ul;
-        data_.resize(size, default_value);
+        if(!growable_ || size > data_.size()) {
+            data_.resize(size, default_value);
+        }
         data_ptr_ = data_.data();
 
     }
@@ -248,30 +287,107 @@ public:
                        const T default_value = T())
     {
         size_ = size;
-        data_.resize(capacity, default_value);
+        if(!growable_ || capacity > data_.size()) {
+            data_.resize(capacity, default_value);
+        }
         data_ptr_ = data_.data();
     }
 
     /**
-     * @brief Emplace value at the end within the given capacity.
-     * @param value - the value to be emplaced.
+     * @brief Enable or disable growing beyond the capacity. If enabled, the
+     *        capacity is doubled when it is exceeded and resizing never
+     *        reduces it, otherwise exceeding it throws. Growing invalidates
+     *        iterators and references.
+     * @param growable - whether the vector may grow
      */
-    inline void emplace_back(T&& value)
+    inline void set_growable(const bool growable)
     {
-        if(size_ == data_.size()) {
-            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        growable_ = growable;
+    }
+
+    inline bool is_growable() const
+    {
+        return growable_;
+    }
+
+    /**
+     * @brief Make sure the capacity is at least capacity, never shrinks.
+     *        New entries are value-initialized.
+     * @param capacity  - the minimum capacity
+     */
+    inline void reserve(const std::size_t capacity)
+    {
+        if(capacity > data_.size()) {
+            data_.resize(capacity, T());
+            data_ptr_ = data_.data();
         }
-        data_ptr_[size_] = value;
-        ++size_;
     }
 
-    inline void push_back(const T &value)
+    /**
+     * @brief Make sure the capacity is at least capacity, never shrinks.
+     *        Only with a default_init_allocator, see
+     *        default_init_buffered_vector, new entries are default-initialized,
+     *        e.g. floats are left uninitialized instead of being zeroed. With
+     *        any other allocator this is the same as reserve.
+     * @param capacity  - the minimum capacity
+     */
+    inline void reserve_uninitialized(const std::size_t capacity)
     {
-        if(size_ == data_.size()) {
-            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        if(capacity > data_.size()) {
+            data_.resize(capacity);
+            data_ptr_ = data_.data();
+        }
+    }
+
+    /**
+     * @brief Construct a value at the end. A single argument T is assignable
+     *        from is assigned to the existing entry, so that the entry keeps
+     *        its resources. Otherwise the entry is replaced in place if T can
+     *        be constructed from args without throwing, or a temporary is
+     *        move-assigned. args may refer to entries of the vector itself,
+     *        e.g. emplace_back(front()), also when it grows.
+     * @param args - the constructor arguments
+     * @return reference to the new value
+     */
+    template<typename... Args>
+    inline T& emplace_back(Args&&... args)
+    {
+        if constexpr (is_assignable_from<Args...>::value) {
+            return assign_back(std::forward<Args>(args)...);
+        } else {
+            if(size_ == data_.size()) {
+                /// construct before growing releases the entries args refer to
+                T value(std::forward<Args>(args)...);
+                grow();
+                T &entry = data_ptr_[size_++];
+                entry = std::move(value);
+                return entry;
+            }
+            T *entry = data_ptr_ + size_;
+            if constexpr (std::is_nothrow_constructible<T, Args...>::value) {
+                entry->~T();
+                entry = ::new (static_cast<void*>(entry)) T(std::forward<Args>(args)...);
+            } else {
+                *entry = T(std::forward<Args>(args)...);
+            }
+            ++size_;
+            return *entry;
         }
-        data_ptr_[size_] = value;
-        ++size_;
+    }
+
+    /**
+     * @brief Copy a value to the end, the entry is assigned and thus keeps
+     *        its resources.
+     * @param value - the value, may be an entry of the vector itself
+     */
+    inline void push_back(const T &value)
+    {
+        assign_back(value);
+    }
+
+    inline void push_back(T &&value)
+    {
+        assign_back(std::move(value));
     }
 
     /**
@@ -291,9 +407,45 @@ private:
     std::size_t           size_;
     std::vector<T, Alloc> data_;
     T*                    data_ptr_;
+    bool                  growable_;
 
+    /// whether an entry can be assigned from the emplace_back arguments
+    template<typename... Args>
+    struct is_assignable_from : std::false_type {};
+    template<typename Arg>
+    struct is_assignable_from<Arg> : std::is_assignable<T&, Arg&&> {};
 
+    template<typename U>
+    inline T& assign_back(U &&value)
+    {
+        if(size_ == data_.size()) {
+            /// copy before growing releases the entry value may refer to
+            T copy(std::forward<U>(value));
+            grow();
+            T &entry = data_ptr_[size_++];
+            entry = std::move(copy);
+            return entry;
+        }
+        T &entry = data_ptr_[size_++];
+        entry = std::forward<U>(value);
+        return entry;
+    }
+
+    inline void grow()
+    {
+        if(!growable_) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        reserve_uninitialized(std::max<std::size_t>(2 * data_.size(), 1));
+    }
 };
+
+/**
+ * @brief Buffered vector which default-initializes its entries, thus
+ *        arithmetic types are not zeroed on construction and resize.
+ */
+template<typename T>
+using default_init_buffered_vector = buffered_vector<T, default_init_allocator<T>>;
 }
 }
 
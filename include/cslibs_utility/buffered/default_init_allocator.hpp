@@ -0,0 +1,51 @@
+#ifndef CSLIBS_UTILITY_DEFAULT_INIT_ALLOCATOR_HPP
+#define CSLIBS_UTILITY_DEFAULT_INIT_ALLOCATOR_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cslibs_utility {
+namespace buffered {
+/**
+ * @brief The default_init_allocator class adapts an allocator such that
+ *        containers default-initialize instead of value-initialize their
+ *        elements, e.g. resizing a vector of floats does not zero them.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class default_init_allocator : public Alloc {
+    using traits_t = std::allocator_traits<Alloc>;
+
+public:
+    template<typename U>
+    struct rebind {
+        using other = default_init_allocator<U, typename traits_t::template rebind_alloc<U>>;
+    };
+
+    using Alloc::Alloc;
+
+    default_init_allocator() = default;
+
+    template<typename U, typename A>
+    default_init_allocator(const default_init_allocator<U, A> &other) noexcept :
+        Alloc(static_cast<const A&>(other))
+    {
+    }
+
+    template<typename U>
+    void construct(U *p) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new (static_cast<void*>(p)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U *p, Args&&... args)
+    {
+        traits_t::construct(static_cast<Alloc&>(*this), p, std::forward<Args>(args)...);
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_DEFAULT_INIT_ALLOCATOR_HPP
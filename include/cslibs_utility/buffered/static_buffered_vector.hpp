@@ -0,0 +1,292 @@
+#ifndef CSLIBS_UTILITY_STATIC_BUFFERED_VECTOR_HPP
+#define CSLIBS_UTILITY_STATIC_BUFFERED_VECTOR_HPP
+
+#include <array>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include <assert.h>
+
+namespace cslibs_utility {
+namespace buffered {
+/**
+ * @brief The static_buffered_vector class is a buffered_vector with at most
+ *        N entries, which live inside the object instead of on the heap.
+ *        Like the capacity of a fixed buffered_vector, the capacity is set
+ *        by resize, it is N initially. Entries are default-initialized on
+ *        construction, thus arithmetic types are left uninitialized.
+ */
+template<typename T, std::size_t N>
+class static_buffered_vector {
+public:
+    using Ptr            = std::shared_ptr<static_buffered_vector>;
+    using iterator       = typename std::array<T, N>::iterator;
+    using const_iterator = typename std::array<T, N>::const_iterator;
+
+    static_buffered_vector() :
+        size_(0),
+        capacity_(N)
+    {
+    }
+
+    /**
+     * @brief static_buffered_vector constructor with preferred size.
+     * @param size - preferred value <= N
+     */
+    static_buffered_vector(const std::size_t size) :
+        size_(size),
+        capacity_(N)
+    {
+        assert(size <= N);
+    }
+
+    /**
+     * @brief static_buffered_vector constructor with preferred size.
+     * @param size          - preferred value <= N
+     * @param default_value - default value to initialize with
+     */
+    static_buffered_vector(const std::size_t size,
+                           const T &default_value) :
+        size_(size),
+        capacity_(N)
+    {
+        assert(size <= N);
+        data_.fill(default_value);
+    }
+
+    /**
+     * @brief Return reference to the i-th entry of the vector.
+     *        This operator does not assure validity.
+     * @param i - the index
+     * @return  the i-th entry
+     */
+    T&  operator [] (const std::size_t i)
+    {
+        return data_[i];
+    }
+
+    /**
+     * @brief Return constant reference to the i-th entry of the vector.
+     *        This operator does not assure validity.
+     * @param i - the index
+     * @return  the i-th entry
+     */
+    const T&  operator [] (const std::size_t i) const
+    {
+        return data_[i];
+    }
+
+    /**
+     * @brief Return reference to the i-th entry of the vector.
+     * @param i - the index
+     * @return  the i-th entry
+     */
+    T&  at (const std::size_t i)
+    {
+        if(i >= size_) {
+            throw std::runtime_error("Index out of bounds!");
+        }
+        return data_[i];
+    }
+
+    /**
+     * @brief Return constant reference to the i-th entry of the vector.
+     * @param i - the index
+     * @return  the i-th entry
+     */
+    const T&  at (const std::size_t i) const
+    {
+        if(i >= size_) {
+            throw std::runtime_error("Index out of bounds!");
+        }
+        return data_[i];
+    }
+
+    inline T& front()
+    {
+        return data_.front();
+    }
+
+    inline const T& front() const
+    {
+        return data_.front();
+    }
+
+    inline T& back()
+    {
+        return at(size_ - 1);
+    }
+
+    inline const T& back() const
+    {
+        return at(size_ - 1);
+    }
+
+    inline iterator begin()
+    {
+        return data_.begin();
+    }
+
+    inline const_iterator begin() const
+    {
+        return data_.begin();
+    }
+
+    inline iterator end()
+    {
+        return data_.begin() + size_;
+    }
+
+    inline const_iterator end() const
+    {
+        return data_.begin() + size_;
+    }
+
+    /**
+     * @brief Iterator pointing past the last entry of the capacity.
+     * @return the limit iterator
+     */
+    inline iterator limit()
+    {
+        return data_.begin() + capacity_;
+    }
+
+    inline const_iterator limit() const
+    {
+        return data_.begin() + capacity_;
+    }
+
+    /**
+     * @brief Return the capacity set by resize, at most N.
+     * @return  the capacity
+     */
+    inline std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    /**
+     * @brief Return the storage size N, the maximum capacity.
+     */
+    static constexpr std::size_t max_capacity()
+    {
+        return N;
+    }
+
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Resize only given size like buffered_vector::resize, that is
+     *        the capacity is set to size and the vector is emptied. The
+     *        entries are kept.
+     * @param size  - the preferred capacity <= N
+     */
+    inline void resize(const std::size_t size,
+                       const T default_value = T())
+    {
+        (void) default_value;
+        if(size > N) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        size_     = 0ul;
+        capacity_ = size;
+    }
+
+    /**
+     * @brief Resize given size and capacity like buffered_vector::resize.
+     *        The entries are kept.
+     * @param size      - the preferred size <= capacity
+     * @param capacity  - the preferred capacity <= N
+     */
+    inline void resize(const std::size_t size,
+                       const std::size_t capacity,
+                       const T default_value = T())
+    {
+        (void) default_value;
+        if(capacity > N) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        assert(size <= capacity);
+        size_     = size;
+        capacity_ = capacity;
+    }
+
+    /**
+     * @brief Construct a value at the end, a single argument T is assignable
+     *        from is assigned, see buffered_vector::emplace_back.
+     * @param args - the constructor arguments
+     * @return reference to the new value
+     */
+    template<typename... Args>
+    inline T& emplace_back(Args&&... args)
+    {
+        if(size_ == capacity_) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        T *entry = data_.data() + size_;
+        if constexpr (is_assignable_from<Args...>::value) {
+            *entry = std::get<0>(std::forward_as_tuple(std::forward<Args>(args)...));
+        } else if constexpr (std::is_nothrow_constructible<T, Args...>::value) {
+            entry->~T();
+            entry = ::new (static_cast<void*>(entry)) T(std::forward<Args>(args)...);
+        } else {
+            *entry = T(std::forward<Args>(args)...);
+        }
+        ++size_;
+        return *entry;
+    }
+
+    inline void push_back(const T &value)
+    {
+        if(size_ == capacity_) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        data_[size_] = value;
+        ++size_;
+    }
+
+    inline void push_back(T &&value)
+    {
+        if(size_ == capacity_) {
+            throw std::runtime_error("Buffered vector reached the capacity limit!");
+        }
+        data_[size_] = std::move(value);
+        ++size_;
+    }
+
+    inline void clear()
+    {
+        size_ = 0;
+    }
+
+    inline T* data()
+    {
+        return data_.data();
+    }
+
+    inline const T* data() const
+    {
+        return data_.data();
+    }
+
+private:
+    std::size_t     size_;
+    std::size_t     capacity_;
+    std::array<T, N> data_;
+
+    /// whether an entry can be assigned from the emplace_back arguments
+    template<typename... Args>
+    struct is_assignable_from : std::false_type {};
+    template<typename Arg>
+    struct is_assignable_from<Arg> : std::is_assignable<T&, Arg&&> {};
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_STATIC_BUFFERED_VECTOR_HPP
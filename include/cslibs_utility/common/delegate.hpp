@@ -4,6 +4,10 @@
 
 #include <cassert>
 
+#include <cstddef>
+
+#include <cstring>
+
 #include <memory>
 
 #include <new>
@@ -16,6 +20,9 @@
  * This code originated from the article
  *     http://codereview.stackexchange.com/questions/14730/impossibly-fast-delegate-in-c11
  * and was copied into this project 31.01.2017.
+ *
+ * Small trivially copyable functors, e.g. lambdas capturing a few pointers,
+ * are stored inline. Larger functors are kept in shared heap storage.
  */
 
 namespace cslibs_utility {
@@ -34,13 +41,29 @@ class delegate<R (A...)>
   }
 
 public:
-
+  static constexpr ::std::size_t inline_size = 32;
 
   delegate() = default;
 
-  delegate(delegate const&) = default;
+  delegate(delegate const& other) :
+    object_ptr_(other.object_ptr_),
+    stub_ptr_(other.stub_ptr_),
+    deleter_(other.deleter_),
+    store_(other.store_),
+    store_size_(other.store_size_)
+  {
+    copy_inline(other);
+  }
 
-  delegate(delegate&&) = default;
+  delegate(delegate&& other) noexcept :
+    object_ptr_(other.object_ptr_),
+    stub_ptr_(other.stub_ptr_),
+    deleter_(other.deleter_),
+    store_(::std::move(other.store_)),
+    store_size_(other.store_size_)
+  {
+    copy_inline(other);
+  }
 
   delegate(::std::nullptr_t) : object_ptr_{nullptr}, stub_ptr_{nullptr} { }
 
@@ -88,25 +111,40 @@ public:
       !::std::is_same<delegate, typename ::std::decay<T>::type>{}
     >::type
   >
-  delegate(T&& f) :
-    store_(operator new(sizeof(typename ::std::decay<T>::type)),
-      functor_deleter<typename ::std::decay<T>::type>),
-    store_size_(sizeof(typename ::std::decay<T>::type))
+  delegate(T&& f)
   {
-    using functor_type = typename ::std::decay<T>::type;
-
-    new (store_.get()) functor_type(::std::forward<T>(f));
-
-    object_ptr_ = store_.get();
+    *this = ::std::forward<T>(f);
+  }
 
-    stub_ptr_ = functor_stub<functor_type>;
+  delegate& operator=(delegate const& rhs)
+  {
+    if (this != &rhs)
+    {
+      object_ptr_ = rhs.object_ptr_;
+      stub_ptr_ = rhs.stub_ptr_;
+      deleter_ = rhs.deleter_;
+      store_ = rhs.store_;
+      store_size_ = rhs.store_size_;
+      copy_inline(rhs);
+    }
 
-    deleter_ = deleter_stub<functor_type>;
+    return *this;
   }
 
-  delegate& operator=(delegate const&) = default;
+  delegate& operator=(delegate&& rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      object_ptr_ = rhs.object_ptr_;
+      stub_ptr_ = rhs.stub_ptr_;
+      deleter_ = rhs.deleter_;
+      store_ = ::std::move(rhs.store_);
+      store_size_ = rhs.store_size_;
+      copy_inline(rhs);
+    }
 
-  delegate& operator=(delegate&&) = default;
+    return *this;
+  }
 
   template <class C>
   delegate& operator=(R (C::* const rhs)(A...))
@@ -130,7 +168,20 @@ public:
   {
     using functor_type = typename ::std::decay<T>::type;
 
-    if ((sizeof(functor_type) > store_size_) || !store_.unique())
+    if constexpr (is_inline_functor<functor_type>{})
+    {
+      store_.reset();
+
+      ::std::memset(buffer_, 0, inline_size);
+
+      object_ptr_ = new (buffer_) functor_type(::std::forward<T>(f));
+
+      stub_ptr_ = functor_stub<functor_type>;
+
+      return *this;
+    }
+
+    if ((sizeof(functor_type) > store_size_) || (store_.use_count() != 1))
     {
       store_.reset(operator new(sizeof(functor_type)),
         functor_deleter<functor_type>);
@@ -237,6 +288,12 @@ public:
 
   bool operator==(delegate const& rhs) const noexcept
   {
+    if (is_inline() || rhs.is_inline())
+    {
+      return is_inline() && rhs.is_inline() && (stub_ptr_ == rhs.stub_ptr_) &&
+        (::std::memcmp(buffer_, rhs.buffer_, inline_size) == 0);
+    }
+
     return (object_ptr_ == rhs.object_ptr_) && (stub_ptr_ == rhs.stub_ptr_);
   }
 
@@ -247,6 +304,17 @@ public:
 
   bool operator<(delegate const& rhs) const noexcept
   {
+    if (is_inline() != rhs.is_inline())
+    {
+      return is_inline();
+    }
+
+    if (is_inline())
+    {
+      return (stub_ptr_ < rhs.stub_ptr_) || ((stub_ptr_ == rhs.stub_ptr_) &&
+        (::std::memcmp(buffer_, rhs.buffer_, inline_size) < 0));
+    }
+
     return (object_ptr_ < rhs.object_ptr_) ||
       ((object_ptr_ == rhs.object_ptr_) && (stub_ptr_ < rhs.stub_ptr_));
   }
@@ -273,13 +341,38 @@ private:
 
   using deleter_type = void (*)(void*);
 
-  void* object_ptr_;
+  void* object_ptr_{};
   stub_ptr_type stub_ptr_{};
 
-  deleter_type deleter_;
+  deleter_type deleter_{};
 
   ::std::shared_ptr<void> store_;
-  ::std::size_t store_size_;
+  ::std::size_t store_size_{};
+
+  alignas(::std::max_align_t) unsigned char buffer_[inline_size];
+
+  template <typename T>
+  struct is_inline_functor : ::std::integral_constant<bool,
+    (sizeof(T) <= inline_size) &&
+    (alignof(T) <= alignof(::std::max_align_t)) &&
+    ::std::is_trivially_copyable<T>{}>
+  {
+  };
+
+  bool is_inline() const noexcept
+  {
+    return object_ptr_ == static_cast<void const*>(buffer_);
+  }
+
+  void copy_inline(delegate const& other) noexcept
+  {
+    if (other.is_inline())
+    {
+      ::std::memcpy(buffer_, other.buffer_, inline_size);
+
+      object_ptr_ = buffer_;
+    }
+  }
 
   template <class T>
   static void functor_deleter(void* const p)
@@ -366,7 +459,8 @@ namespace std
   {
     size_t operator()(::cslibs_utility::common::delegate<R (A...)> const& d) const noexcept
     {
-      auto const seed(hash<void*>()(d.object_ptr_));
+      // inline functors compare by value, thus their address is no key
+      auto const seed(hash<void*>()(d.is_inline() ? nullptr : d.object_ptr_));
 
       return hash<typename ::cslibs_utility::common::delegate<R (A...)>::stub_ptr_type>()(
         d.stub_ptr_) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
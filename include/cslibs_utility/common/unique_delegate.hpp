@@ -0,0 +1,285 @@
+#pragma once
+#ifndef UNIQUE_DELEGATE_HPP
+# define UNIQUE_DELEGATE_HPP
+
+#include <cstddef>
+
+#include <new>
+
+#include <type_traits>
+
+#include <utility>
+
+/**
+ * Move-only counterpart of delegate. The functor is owned exclusively, thus
+ * no reference counting is involved. Functors which fit into the inline
+ * buffer and can be moved without throwing are stored inline, any other
+ * functor is allocated once on construction.
+ */
+
+namespace cslibs_utility {
+namespace common {
+template <typename T> class unique_delegate;
+
+template<class R, class ...A>
+class unique_delegate<R (A...)>
+{
+  using stub_ptr_type = R (*)(void*, A&&...);
+
+  enum class operation { move, destroy };
+
+  using manager_type =
+    void (*)(operation, unique_delegate*, unique_delegate*);
+
+  unique_delegate(void* const o, stub_ptr_type const m) noexcept :
+    object_ptr_(o),
+    stub_ptr_(m)
+  {
+  }
+
+public:
+  static constexpr ::std::size_t inline_size = 32;
+
+  unique_delegate() = default;
+
+  unique_delegate(::std::nullptr_t) noexcept { }
+
+  unique_delegate(unique_delegate const&) = delete;
+
+  unique_delegate(unique_delegate&& other) noexcept
+  {
+    move_from(other);
+  }
+
+  template <
+    typename T,
+    typename = typename ::std::enable_if<
+      !::std::is_same<unique_delegate, typename ::std::decay<T>::type>{}
+    >::type
+  >
+  unique_delegate(T&& f)
+  {
+    using functor_type = typename ::std::decay<T>::type;
+
+    if constexpr (is_inline_functor<functor_type>{})
+    {
+      object_ptr_ = new (buffer_) functor_type(::std::forward<T>(f));
+
+      manager_ = inline_manager<functor_type>;
+    }
+    else
+    {
+      object_ptr_ = new functor_type(::std::forward<T>(f));
+
+      manager_ = heap_manager<functor_type>;
+    }
+
+    stub_ptr_ = functor_stub<functor_type>;
+  }
+
+  template <class C>
+  unique_delegate(C* const object_ptr, R (C::* const method_ptr)(A...)) :
+    unique_delegate([object_ptr, method_ptr](A... args) {
+      return (object_ptr->*method_ptr)(::std::forward<A>(args)...);
+    })
+  {
+  }
+
+  template <class C>
+  unique_delegate(C const* const object_ptr,
+    R (C::* const method_ptr)(A...) const) :
+    unique_delegate([object_ptr, method_ptr](A... args) {
+      return (object_ptr->*method_ptr)(::std::forward<A>(args)...);
+    })
+  {
+  }
+
+  ~unique_delegate() { reset(); }
+
+  unique_delegate& operator=(unique_delegate const&) = delete;
+
+  unique_delegate& operator=(unique_delegate&& rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      reset();
+
+      move_from(rhs);
+    }
+
+    return *this;
+  }
+
+  unique_delegate& operator=(::std::nullptr_t) noexcept
+  {
+    reset();
+
+    return *this;
+  }
+
+  template <R (* const function_ptr)(A...)>
+  static unique_delegate from() noexcept
+  {
+    return { nullptr, function_stub<function_ptr> };
+  }
+
+  template <class C, R (C::* const method_ptr)(A...)>
+  static unique_delegate from(C* const object_ptr) noexcept
+  {
+    return { object_ptr, method_stub<C, method_ptr> };
+  }
+
+  template <class C, R (C::* const method_ptr)(A...) const>
+  static unique_delegate from(C const* const object_ptr) noexcept
+  {
+    return { const_cast<C*>(object_ptr), const_method_stub<C, method_ptr> };
+  }
+
+  template <class C, R (C::* const method_ptr)(A...)>
+  static unique_delegate from(C& object) noexcept
+  {
+    return { &object, method_stub<C, method_ptr> };
+  }
+
+  template <class C, R (C::* const method_ptr)(A...) const>
+  static unique_delegate from(C const& object) noexcept
+  {
+    return { const_cast<C*>(&object), const_method_stub<C, method_ptr> };
+  }
+
+  void reset() noexcept
+  {
+    if (manager_)
+    {
+      manager_(operation::destroy, this, nullptr);
+    }
+
+    object_ptr_ = nullptr;
+    stub_ptr_ = nullptr;
+    manager_ = nullptr;
+  }
+
+  void swap(unique_delegate& other) noexcept
+  {
+    unique_delegate tmp(::std::move(other));
+
+    other = ::std::move(*this);
+
+    *this = ::std::move(tmp);
+  }
+
+  bool operator==(::std::nullptr_t) const noexcept
+  {
+    return stub_ptr_ == nullptr;
+  }
+
+  bool operator!=(::std::nullptr_t) const noexcept
+  {
+    return stub_ptr_ != nullptr;
+  }
+
+  explicit operator bool() const noexcept { return stub_ptr_; }
+
+  R operator()(A... args) const
+  {
+//  assert(stub_ptr);
+    return stub_ptr_(object_ptr_, ::std::forward<A>(args)...);
+  }
+
+private:
+  void* object_ptr_{};
+  stub_ptr_type stub_ptr_{};
+
+  manager_type manager_{};
+
+  alignas(::std::max_align_t) unsigned char buffer_[inline_size];
+
+  template <typename T>
+  struct is_inline_functor : ::std::integral_constant<bool,
+    (sizeof(T) <= inline_size) &&
+    (alignof(T) <= alignof(::std::max_align_t)) &&
+    ::std::is_nothrow_move_constructible<T>{}>
+  {
+  };
+
+  void move_from(unique_delegate& other) noexcept
+  {
+    stub_ptr_ = other.stub_ptr_;
+    manager_ = other.manager_;
+
+    if (manager_)
+    {
+      manager_(operation::move, this, &other);
+    }
+    else
+    {
+      object_ptr_ = other.object_ptr_;
+    }
+
+    other.object_ptr_ = nullptr;
+    other.stub_ptr_ = nullptr;
+    other.manager_ = nullptr;
+  }
+
+  template <class T>
+  static void inline_manager(operation const op, unique_delegate* const dst,
+    unique_delegate* const src) noexcept
+  {
+    if (op == operation::move)
+    {
+      T* const functor(static_cast<T*>(src->object_ptr_));
+
+      dst->object_ptr_ = new (dst->buffer_) T(::std::move(*functor));
+
+      functor->~T();
+    }
+    else
+    {
+      static_cast<T*>(dst->object_ptr_)->~T();
+    }
+  }
+
+  template <class T>
+  static void heap_manager(operation const op, unique_delegate* const dst,
+    unique_delegate* const src) noexcept
+  {
+    if (op == operation::move)
+    {
+      dst->object_ptr_ = src->object_ptr_;
+    }
+    else
+    {
+      delete static_cast<T*>(dst->object_ptr_);
+    }
+  }
+
+  template <R (*function_ptr)(A...)>
+  static R function_stub(void* const, A&&... args)
+  {
+    return function_ptr(::std::forward<A>(args)...);
+  }
+
+  template <class C, R (C::*method_ptr)(A...)>
+  static R method_stub(void* const object_ptr, A&&... args)
+  {
+    return (static_cast<C*>(object_ptr)->*method_ptr)(
+      ::std::forward<A>(args)...);
+  }
+
+  template <class C, R (C::*method_ptr)(A...) const>
+  static R const_method_stub(void* const object_ptr, A&&... args)
+  {
+    return (static_cast<C const*>(object_ptr)->*method_ptr)(
+      ::std::forward<A>(args)...);
+  }
+
+  template <typename T>
+  static R functor_stub(void* const object_ptr, A&&... args)
+  {
+    return (*static_cast<T*>(object_ptr))(::std::forward<A>(args)...);
+  }
+};
+}
+}
+
+#endif // UNIQUE_DELEGATE_HPP
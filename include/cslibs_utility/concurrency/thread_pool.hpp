@@ -0,0 +1,337 @@
+#ifndef CSLIBS_UTILITY_CONCURRENCY_THREAD_POOL_HPP
+#define CSLIBS_UTILITY_CONCURRENCY_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <cslibs_utility/common/unique_delegate.hpp>
+#include <cslibs_utility/synchronized/event_count.hpp>
+
+namespace cslibs_utility {
+namespace concurrency {
+/**
+ * @brief The thread_pool class executes tasks on a fixed set of workers. Each
+ *        worker owns a deque, tasks submitted by a worker go to its own deque
+ *        and are taken back LIFO, while idle workers steal the oldest tasks of
+ *        the others. Tasks from other threads are spread round robin. Idle
+ *        workers sleep on an event count, so submitting costs no syscall as
+ *        long as the workers are busy.
+ *        Threads waiting in parallel_for execute pending tasks meanwhile,
+ *        thus nested parallel loops do not deadlock, and sleep on the event
+ *        count once there is nothing left to take.
+ */
+class thread_pool
+{
+public:
+    using task_t = common::unique_delegate<void()>;
+
+    /**
+     * @brief thread_pool constructor.
+     * @param threads   - number of workers, zero selects the hardware concurrency
+     * @param cpus      - optional cpus to pin the workers to, worker i is pinned
+     *                    to cpus[i % cpus.size()], only supported on Linux
+     */
+    inline explicit thread_pool(const std::size_t threads = 0,
+                                const std::vector<int> &cpus = std::vector<int>()) :
+        pending_(0),
+        next_(0),
+        stop_(false)
+    {
+        const std::size_t n = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+        for(std::size_t i = 0 ; i < n ; ++i)
+            queues_.emplace_back(new worker_queue);
+        workers_.reserve(n);
+        for(std::size_t i = 0 ; i < n ; ++i) {
+            workers_.emplace_back([this, i](){loop(i);});
+            if(!cpus.empty())
+                pin(workers_.back(), cpus[i % cpus.size()]);
+        }
+    }
+
+    /**
+     * @brief Executes all pending tasks, then joins the workers.
+     */
+    inline ~thread_pool()
+    {
+        stop_.store(true, std::memory_order_seq_cst);
+        event_.notify_all();
+        for(auto &w : workers_)
+            w.join();
+    }
+
+    thread_pool(const thread_pool &other) = delete;
+    thread_pool& operator = (const thread_pool &other) = delete;
+
+    /**
+     * @brief A pool shared by the whole process, sized to the hardware
+     *        concurrency and created on first use.
+     */
+    static inline thread_pool& global()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    inline std::size_t size() const
+    {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Whether the calling thread is a worker of this pool.
+     */
+    inline bool is_worker() const
+    {
+        return current().pool == this;
+    }
+
+    /**
+     * @brief Execute a task without a future, exceptions escaping the task
+     *        terminate the program like in a std::thread.
+     */
+    template<typename Function>
+    inline void execute(Function &&function)
+    {
+        push(task_t(std::forward<Function>(function)));
+    }
+
+    /**
+     * @brief Execute function(args...) asynchronously.
+     * @return the future result, which also carries exceptions
+     */
+    template<typename Function, typename... Args>
+    inline auto submit(Function &&function, Args&&... args)
+        -> std::future<std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>>
+    {
+        using result_t = std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>;
+        std::packaged_task<result_t()> task(
+                    [f = std::forward<Function>(function),
+                     t = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            return std::apply(std::move(f), std::move(t));
+        });
+        std::future<result_t> future = task.get_future();
+        push(task_t([task = std::move(task)]() mutable {task();}));
+        return future;
+    }
+
+    /**
+     * @brief Call function(first, last) for consecutive chunks of
+     *        [begin, end) in parallel, the calling thread takes part. The
+     *        first exception thrown is rethrown once all chunks are done.
+     * @param begin     - first index
+     * @param end       - index past the last one
+     * @param function  - called as function(first, last)
+     * @param grain     - chunk size, zero splits into four chunks per worker
+     */
+    template<typename Function>
+    inline void parallel_chunks(const std::size_t begin,
+                                const std::size_t end,
+                                Function &&function,
+                                const std::size_t grain = 0)
+    {
+        if(end <= begin)
+            return;
+        const std::size_t n      = end - begin;
+        const std::size_t chunk  = grain > 0 ? grain : std::max<std::size_t>(n / (4 * size()), 1);
+        const std::size_t chunks = (n + chunk - 1) / chunk;
+
+        std::atomic<std::size_t> next(0);
+        std::atomic<std::size_t> finished(0);
+        std::mutex               error_mutex;
+        std::exception_ptr       error;
+        auto body = [&]() {
+            for(std::size_t c = next.fetch_add(1, std::memory_order_relaxed) ; c < chunks ;
+                c = next.fetch_add(1, std::memory_order_relaxed)) {
+                const std::size_t first = begin + c * chunk;
+                try {
+                    function(first, std::min(first + chunk, end));
+                } catch(...) {
+                    std::unique_lock<std::mutex> l(error_mutex);
+                    if(!error)
+                        error = std::current_exception();
+                }
+            }
+        };
+
+        const std::size_t helpers = std::min(chunks - 1, size());
+        for(std::size_t h = 0 ; h < helpers ; ++h) {
+            push(task_t([this, &body, &finished]() {
+                body();
+                /// the frame of the caller may be gone past this point
+                finished.fetch_add(1, std::memory_order_seq_cst);
+                event_.notify_all();
+            }));
+        }
+        body();
+        /// helpers reference this frame, run other tasks until they are done
+        const std::size_t index = is_worker() ? current().index : 0;
+        while(finished.load(std::memory_order_acquire) < helpers) {
+            if(try_run(index))
+                continue;
+            event_.await([this, &finished, helpers]() {
+                return finished.load(std::memory_order_seq_cst) >= helpers ||
+                       pending_.load(std::memory_order_seq_cst) > 0;
+            });
+        }
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+    /**
+     * @brief Call function(i) for each i in [begin, end) in parallel.
+     * @param grain - chunk size, zero splits into four chunks per worker
+     */
+    template<typename Function>
+    inline void parallel_for(const std::size_t begin,
+                             const std::size_t end,
+                             Function &&function,
+                             const std::size_t grain = 0)
+    {
+        parallel_chunks(begin, end, [&function](const std::size_t first, const std::size_t last) {
+            for(std::size_t i = first ; i < last ; ++i)
+                function(i);
+        }, grain);
+    }
+
+private:
+    struct alignas(64) worker_queue {
+        std::mutex          mutex;
+        std::deque<task_t>  tasks;
+    };
+
+    struct worker_id {
+        const thread_pool  *pool  = nullptr;
+        std::size_t         index = 0;
+    };
+
+    std::vector<std::unique_ptr<worker_queue>>  queues_;
+    std::vector<std::thread>                    workers_;
+    std::atomic<std::size_t>                    pending_;   /// queued tasks not yet taken
+    std::atomic<std::size_t>                    next_;      /// round robin for external submits
+    std::atomic_bool                            stop_;
+    synchronized::event_count                   event_;
+
+    static inline worker_id& current()
+    {
+        thread_local worker_id id;
+        return id;
+    }
+
+    static inline void pin(std::thread &thread, const int cpu)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &set);
+#else
+        (void) thread;
+        (void) cpu;
+#endif
+    }
+
+    inline void push(task_t &&task)
+    {
+        const std::size_t index = is_worker() ?
+                    current().index : next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        {
+            worker_queue &q = *queues_[index];
+            std::unique_lock<std::mutex> l(q.mutex);
+            q.tasks.emplace_back(std::move(task));
+            /// counted under the lock before it can be taken, thus the count
+            /// never wraps and pending_ > 0 means a task can be taken
+            pending_.fetch_add(1, std::memory_order_seq_cst);
+        }
+        event_.notify_all();
+    }
+
+    /**
+     * @brief Run one task, preferably the newest of the own queue, otherwise
+     *        the oldest one stolen from another queue. Contended queues are
+     *        skipped at first and locked blocking if no other queue had a
+     *        task, so that a thread finding nothing can go to sleep.
+     */
+    inline bool try_run(const std::size_t index)
+    {
+        task_t task;
+        {
+            worker_queue &q = *queues_[index];
+            std::unique_lock<std::mutex> l(q.mutex);
+            take_back(q, task);
+        }
+        bool contended = false;
+        for(std::size_t i = 1 ; !task && i < queues_.size() ; ++i) {
+            worker_queue &q = *queues_[(index + i) % queues_.size()];
+            std::unique_lock<std::mutex> l(q.mutex, std::try_to_lock);
+            if(l.owns_lock()) {
+                take_front(q, task);
+            } else {
+                contended = true;
+            }
+        }
+        for(std::size_t i = 1 ; contended && !task && i < queues_.size() ; ++i) {
+            worker_queue &q = *queues_[(index + i) % queues_.size()];
+            std::unique_lock<std::mutex> l(q.mutex);
+            take_front(q, task);
+        }
+        if(!task)
+            return false;
+        task();
+        return true;
+    }
+
+    /// take the newest task of q, the lock of q has to be held
+    inline void take_back(worker_queue &q, task_t &task)
+    {
+        if(q.tasks.empty())
+            return;
+        task = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// take the oldest task of q, the lock of q has to be held
+    inline void take_front(worker_queue &q, task_t &task)
+    {
+        if(q.tasks.empty())
+            return;
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline void loop(const std::size_t index)
+    {
+        current() = worker_id{this, index};
+        for(;;) {
+            if(try_run(index))
+                continue;
+            if(stop_.load(std::memory_order_seq_cst) &&
+               pending_.load(std::memory_order_seq_cst) == 0)
+                return;
+            event_.await([this]() {
+                return pending_.load(std::memory_order_seq_cst) > 0 ||
+                       stop_.load(std::memory_order_seq_cst);
+            });
+        }
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_CONCURRENCY_THREAD_POOL_HPP
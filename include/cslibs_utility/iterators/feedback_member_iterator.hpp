@@ -1,28 +1,34 @@
 #ifndef CSLIBS_UTILITY_FEEDBACK_MEMBER_ITERATOR_HPP
 #define CSLIBS_UTILITY_FEEDBACK_MEMBER_ITERATOR_HPP
 
+#include <cstddef>
+#include <iterator>
+
 #include <cslibs_utility/common/delegate.hpp>
 
 namespace cslibs_utility {
 namespace iterators {
 /**
- * @brief The MemberIterator class is used to make a certain member of a data
+ * @brief The FeedbackMemberIterator class is used to make a certain member of a data
  *        class available, whereas the full data entry can only be accessed by
- *        const reference.
+ *        const reference. Each accessed member is reported by a callback.
  */
 template<typename data_t, typename T, T data_t::*Member>
-class FeedbackMemberIterator : public std::iterator<std::random_access_iterator_tag, T>
+class FeedbackMemberIterator
 {
-    using parent    = std::iterator<std::random_access_iterator_tag, T>;
-    using iterator  = typename parent::iterator;
-    using reference = typename parent::reference;
-
     using notify_update = cslibs_utility::common::delegate<void(const T &)>;
 
     data_t            *data_;     /// data container content
     notify_update    update_;   /// on update callback
 
 public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+    using iterator          = FeedbackMemberIterator<data_t, T, Member>;
+
     /**
      * @brief MemberIterator constructor.
      * @param begin     - point to the data in memory
@@ -98,9 +104,9 @@ template<typename data_t, typename container_t, typename T, T data_t::*Member>
 class FeedbackMemberDecorator {
 public:
     using iterator_t      = FeedbackMemberIterator<data_t, T, Member>;
-    using notify_update   = delegate<void(const T&)>;
-    using notify_touch    = delegate<void()>;
-    using notify_finished = delegate<void()>;
+    using notify_update   = common::delegate<void(const T&)>;
+    using notify_touch    = common::delegate<void()>;
+    using notify_finished = common::delegate<void()>;
 
     FeedbackMemberDecorator(container_t                &data,
                     notify_touch                touch,
@@ -164,7 +170,7 @@ public:
             touch_();
         }
 
-        return iterator_t(&(*data_.begin()), update_);
+        return iterator_t(std::data(data_), update_);
     }
 
     /**
@@ -174,7 +180,7 @@ public:
      * @return iterato at position n+1
      */
     inline iterator_t end() {
-        return iterator_t(&(*data_.end()), update_);
+        return iterator_t(std::data(data_) + std::size(data_), update_);
     }
 
     /**
@@ -193,6 +199,193 @@ private:
     notify_update              update_;    /// on update callback
     notify_finished            finished_;
 };
+
+/**
+ * @brief The FeedbackBatch class collects accessed members and reports them
+ *        in blocks of BatchSize, thus the update callback is called once per
+ *        block instead of once per element.
+ */
+template<typename T, std::size_t BatchSize>
+class FeedbackBatch {
+public:
+    using notify_update_batch = common::delegate<void(const T*, std::size_t)>;
+
+    explicit FeedbackBatch(notify_update_batch update) :
+        size_(0),
+        update_(update)
+    {
+    }
+
+    FeedbackBatch(const FeedbackBatch &other) = delete;
+    FeedbackBatch& operator = (const FeedbackBatch &other) = delete;
+
+    inline void push(const T &t)
+    {
+        values_[size_] = t;
+        if(++size_ == BatchSize)
+            flush();
+    }
+
+    /**
+     * @brief Report all collected members.
+     */
+    inline void flush()
+    {
+        if(size_ > 0) {
+            update_(values_, size_);
+            size_ = 0;
+        }
+    }
+
+private:
+    T                   values_[BatchSize];
+    std::size_t         size_;
+    notify_update_batch update_;
+};
+
+/**
+ * @brief The BatchedFeedbackMemberIterator class works like the
+ *        FeedbackMemberIterator, but hands the accessed members to a batch
+ *        shared by all iterators of a decorator.
+ */
+template<typename data_t, typename T, T data_t::*Member, std::size_t BatchSize = 256>
+class BatchedFeedbackMemberIterator
+{
+    using batch_t = FeedbackBatch<T, BatchSize>;
+
+    data_t  *data_;     /// data container content
+    batch_t *batch_;    /// collects the accessed members
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+    using iterator          = BatchedFeedbackMemberIterator<data_t, T, Member, BatchSize>;
+
+    /**
+     * @brief BatchedFeedbackMemberIterator constructor.
+     * @param begin     - point to the data in memory
+     * @param batch     - the batch collecting accessed members
+     */
+    explicit BatchedFeedbackMemberIterator(data_t  *begin,
+                                           batch_t *batch) :
+        data_(begin),
+        batch_(batch)
+    {
+    }
+
+    /**
+     * @brief operator ++ increments the position within the iterable data and adds the
+     *        previously accessed member to the batch.
+     * @return the new iterator state
+     */
+    inline iterator& operator++()
+    {
+        batch_->push(data_->*Member);
+        ++data_;
+        return *this;
+    }
+
+    inline bool operator ==(const iterator &_other) const
+    {
+        return data_ == _other.data_;
+    }
+
+    inline bool operator !=(const iterator &_other) const
+    {
+        return !(*this == _other);
+    }
+
+    inline reference operator *() const
+    {
+        return (data_->*Member);
+    }
+
+    inline const data_t& getData() const
+    {
+        return *data_;
+    }
+};
+
+/**
+ * @brief The BatchedFeedbackMemberDecorator class is the batched counterpart of the
+ *        FeedbackMemberDecorator. Accessed members are reported in blocks of
+ *        BatchSize, the last partial block is reported before the finished callback.
+ */
+template<typename data_t, typename container_t, typename T, T data_t::*Member, std::size_t BatchSize = 256>
+class BatchedFeedbackMemberDecorator {
+public:
+    using iterator_t          = BatchedFeedbackMemberIterator<data_t, T, Member, BatchSize>;
+    using batch_t             = FeedbackBatch<T, BatchSize>;
+    using notify_update_batch = typename batch_t::notify_update_batch;
+    using notify_touch        = common::delegate<void()>;
+    using notify_finished     = common::delegate<void()>;
+
+    BatchedFeedbackMemberDecorator(container_t        &data,
+                                   notify_touch        touch,
+                                   notify_update_batch update,
+                                   notify_finished     finished) :
+        data_(data),
+        untouched_(true),
+        touch_(touch),
+        batch_(update),
+        finished_(finished)
+    {
+    }
+
+    BatchedFeedbackMemberDecorator(container_t        &data,
+                                   notify_touch        touch,
+                                   notify_update_batch update) :
+        BatchedFeedbackMemberDecorator(data, touch, update, [](){return;})
+    {
+    }
+
+    virtual ~BatchedFeedbackMemberDecorator()
+    {
+        if(!untouched_) {
+            batch_.flush();
+            finished_();
+        }
+    }
+
+    inline iterator_t begin()
+    {
+        if(untouched_) {
+            untouched_ = false;
+            touch_();
+        }
+
+        return iterator_t(std::data(data_), &batch_);
+    }
+
+    inline iterator_t end()
+    {
+        return iterator_t(std::data(data_) + std::size(data_), &batch_);
+    }
+
+    /**
+     * @brief Report the members collected so far without waiting for the
+     *        block to be completed.
+     */
+    inline void flush()
+    {
+        batch_.flush();
+    }
+
+    inline const container_t& getData() const
+    {
+        return data_;
+    }
+
+private:
+    container_t               &data_;      /// the container to be iterated
+    bool                       untouched_;
+    notify_touch               touch_;     /// notify wether an iterator is in use or not
+    batch_t                    batch_;     /// collects and reports accessed members
+    notify_finished            finished_;
+};
 }
 }
 #endif // CSLIBS_UTILITY_FEEDBACK_MEMBER_ITERATOR_HPP
@@ -1,6 +1,9 @@
 #ifndef CSLIBS_UTILITY_MEMBER_ITERATOR_HPP
 #define CSLIBS_UTILITY_MEMBER_ITERATOR_HPP
 
+#include <cstddef>
+#include <iterator>
+
 #include <cslibs_utility/common/delegate.hpp>
 
 namespace cslibs_utility {
@@ -11,30 +14,34 @@ namespace iterators {
  *        const reference.
  */
 template<typename data_t, typename T, T data_t::*Member>
-class MemberIterator : public std::iterator<std::random_access_iterator_tag, T>
+class MemberIterator
 {
-    using parent    = std::iterator<std::random_access_iterator_tag, T>;
-    using iterator  = typename parent::iterator;
-    using reference = typename parent::reference;
-
     data_t *data_;     /// data container content
 
 public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+    using iterator          = MemberIterator<data_t, T, Member>;
+
+    MemberIterator() :
+        data_(nullptr)
+    {
+    }
+
     /**
      * @brief MemberIterator constructor.
      * @param begin     - point to the data in memory
-     * @param update    - on update callback
      */
     explicit MemberIterator(data_t *begin) :
-        data_(begin),
+        data_(begin)
     {
     }
 
     /**
-     * @brief operator ++ increments the position within the iterable data and executes the
-     *        update callback for the previously accessed data.
-     *        It is assumed that the data is iterated till the (n+1)th element though the
-     *        n-th element is the last one meant to be accessed.
+     * @brief operator ++ increments the position within the iterable data.
      * @return the new iterator state
      */
     inline iterator& operator++()
@@ -43,6 +50,78 @@ public:
         return *this;
     }
 
+    inline iterator operator++(int)
+    {
+        iterator i(*this);
+        ++data_;
+        return i;
+    }
+
+    inline iterator& operator--()
+    {
+        --data_;
+        return *this;
+    }
+
+    inline iterator operator--(int)
+    {
+        iterator i(*this);
+        --data_;
+        return i;
+    }
+
+    inline iterator& operator+=(const difference_type n)
+    {
+        data_ += n;
+        return *this;
+    }
+
+    inline iterator& operator-=(const difference_type n)
+    {
+        data_ -= n;
+        return *this;
+    }
+
+    inline iterator operator+(const difference_type n) const
+    {
+        return iterator(data_ + n);
+    }
+
+    friend inline iterator operator+(const difference_type n, const iterator &i)
+    {
+        return i + n;
+    }
+
+    inline iterator operator-(const difference_type n) const
+    {
+        return iterator(data_ - n);
+    }
+
+    inline difference_type operator-(const iterator &_other) const
+    {
+        return data_ - _other.data_;
+    }
+
+    inline bool operator <(const iterator &_other) const
+    {
+        return data_ < _other.data_;
+    }
+
+    inline bool operator >(const iterator &_other) const
+    {
+        return data_ > _other.data_;
+    }
+
+    inline bool operator <=(const iterator &_other) const
+    {
+        return data_ <= _other.data_;
+    }
+
+    inline bool operator >=(const iterator &_other) const
+    {
+        return data_ >= _other.data_;
+    }
+
     /**
      * @brief operator == compares two member iterators.
      * @param _other    - another member iterator
@@ -73,6 +152,16 @@ public:
         return (data_->*Member);
     }
 
+    inline pointer operator ->() const
+    {
+        return &(data_->*Member);
+    }
+
+    inline reference operator [](const difference_type n) const
+    {
+        return (data_ + n)->*Member;
+    }
+
     /**
      * @brief getData returns a const reference to the full data entry not allowing
      *        to change anything. Read only access is the result of that.
@@ -109,7 +198,7 @@ public:
      */
     inline iterator_t begin()
     {
-        return iterator(&(*data_.begin()));
+        return iterator_t(std::data(data_));
     }
 
     /**
@@ -120,7 +209,7 @@ public:
      */
     inline iterator_t end()
     {
-        return iterator(&(*data_.end()));
+        return iterator_t(std::data(data_) + std::size(data_));
     }
 
     /**
@@ -137,4 +226,4 @@ private:
 };
 }
 }
-#endif // CSLIBS_UTILITY_FEEDBACK_MEMBER_ITERATOR_HPP
+#endif // CSLIBS_UTILITY_MEMBER_ITERATOR_HPP
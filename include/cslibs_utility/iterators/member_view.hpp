@@ -0,0 +1,218 @@
+#ifndef CSLIBS_UTILITY_MEMBER_VIEW_HPP
+#define CSLIBS_UTILITY_MEMBER_VIEW_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/concurrency/thread_pool.hpp>
+#include <cslibs_utility/iterators/member_iterator.hpp>
+
+namespace cslibs_utility {
+namespace iterators {
+/**
+ * @brief The MemberView class is a strided view on a certain member of
+ *        contiguously stored data entries. Besides random access it offers
+ *        gather / scatter to and from contiguous buffers as well as
+ *        transforms and reductions, which split the range into chunks
+ *        processed by several threads or by a shared thread pool. The inner
+ *        loops run over raw pointers with a fixed stride, so the compiler can
+ *        vectorize them.
+ */
+template<typename data_t, typename T, T data_t::*Member>
+class MemberView {
+public:
+    using iterator_t = MemberIterator<data_t, T, Member>;
+
+    /**
+     * @brief MemberView constructor.
+     * @param data  - the first data entry
+     * @param size  - number of data entries
+     */
+    MemberView(data_t *data, const std::size_t size) :
+        data_(data),
+        size_(size)
+    {
+    }
+
+    /**
+     * @brief MemberView constructor for contiguous containers.
+     * @param container - the container to be viewed
+     */
+    template<typename container_t>
+    explicit MemberView(container_t &container) :
+        data_(std::data(container)),
+        size_(std::size(container))
+    {
+    }
+
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+
+    inline T& operator [] (const std::size_t i) const
+    {
+        return data_[i].*Member;
+    }
+
+    inline iterator_t begin() const
+    {
+        return iterator_t(data_);
+    }
+
+    inline iterator_t end() const
+    {
+        return iterator_t(data_ + size_);
+    }
+
+    /**
+     * @brief Copy the members into a contiguous buffer.
+     * @param out - buffer of at least size() entries
+     */
+    inline void gather(T *out) const
+    {
+        const data_t *data = data_;
+        for(std::size_t i = 0 ; i < size_ ; ++i)
+            out[i] = data[i].*Member;
+    }
+
+    /**
+     * @brief Copy the members back from a contiguous buffer.
+     * @param in - buffer of at least size() entries
+     */
+    inline void scatter(const T *in) const
+    {
+        data_t *data = data_;
+        for(std::size_t i = 0 ; i < size_ ; ++i)
+            data[i].*Member = in[i];
+    }
+
+    /**
+     * @brief Replace each member m by function(m).
+     * @param function  - the transformation, must be safe to call concurrently
+     * @param threads   - number of threads, chunks are processed in parallel
+     */
+    template<typename Function>
+    inline void transform(Function function,
+                          const std::size_t threads = 1) const
+    {
+        forChunks(threads, [this, &function](const std::size_t begin, const std::size_t end) {
+            data_t *data = data_;
+            for(std::size_t i = begin ; i < end ; ++i)
+                data[i].*Member = function(data[i].*Member);
+        });
+    }
+
+    /**
+     * @brief Replace each member m by function(m), using the workers of pool
+     *        instead of spawning threads.
+     * @param function  - the transformation, must be safe to call concurrently
+     * @param pool      - the pool, the calling thread takes part
+     */
+    template<typename Function>
+    inline void transform(Function function,
+                          concurrency::thread_pool &pool) const
+    {
+        pool.parallel_chunks(0, size_, [this, &function](const std::size_t begin, const std::size_t end) {
+            data_t *data = data_;
+            for(std::size_t i = begin ; i < end ; ++i)
+                data[i].*Member = function(data[i].*Member);
+        }, chunkSize(pool.size()));
+    }
+
+    /**
+     * @brief Reduce the members, each chunk is reduced starting from init,
+     *        the partial results are combined in order afterwards.
+     * @param init      - the identity of op
+     * @param op        - associative reduction, e.g. std::plus<T>()
+     * @param threads   - number of threads, chunks are processed in parallel
+     * @return the reduced value
+     */
+    template<typename R, typename BinaryOp>
+    inline R reduce(const R init,
+                    BinaryOp op,
+                    const std::size_t threads = 1) const
+    {
+        std::vector<R> partials(chunks(threads), init);
+        forChunks(threads, [this, &op, &partials, threads](const std::size_t begin, const std::size_t end) {
+            const data_t *data = data_;
+            R r = partials[begin / chunkSize(threads)];
+            for(std::size_t i = begin ; i < end ; ++i)
+                r = op(r, data[i].*Member);
+            partials[begin / chunkSize(threads)] = r;
+        });
+        R result = init;
+        for(const R &p : partials)
+            result = op(result, p);
+        return result;
+    }
+
+    /**
+     * @brief Reduce the members using the workers of pool, the partial results
+     *        are combined in order afterwards.
+     * @param init      - the identity of op
+     * @param op        - associative reduction, e.g. std::plus<T>()
+     * @param pool      - the pool, the calling thread takes part
+     * @return the reduced value
+     */
+    template<typename R, typename BinaryOp>
+    inline R reduce(const R init,
+                    BinaryOp op,
+                    concurrency::thread_pool &pool) const
+    {
+        const std::size_t chunk_size = chunkSize(pool.size());
+        std::vector<R> partials(chunks(pool.size()), init);
+        pool.parallel_chunks(0, size_, [this, &op, &partials, chunk_size](const std::size_t begin, const std::size_t end) {
+            const data_t *data = data_;
+            R r = partials[begin / chunk_size];
+            for(std::size_t i = begin ; i < end ; ++i)
+                r = op(r, data[i].*Member);
+            partials[begin / chunk_size] = r;
+        }, chunk_size);
+        R result = init;
+        for(const R &p : partials)
+            result = op(result, p);
+        return result;
+    }
+
+private:
+    data_t          *data_;
+    std::size_t      size_;
+
+    inline std::size_t chunkSize(const std::size_t threads) const
+    {
+        const std::size_t n = std::max<std::size_t>(threads, 1);
+        return std::max<std::size_t>((size_ + n - 1) / n, 1);
+    }
+
+    inline std::size_t chunks(const std::size_t threads) const
+    {
+        return (size_ + chunkSize(threads) - 1) / chunkSize(threads);
+    }
+
+    /**
+     * @brief Call function(begin, end) for each chunk, the first chunk is
+     *        processed by the calling thread.
+     */
+    template<typename Function>
+    inline void forChunks(const std::size_t threads, Function &&function) const
+    {
+        if(size_ == 0)
+            return;
+        const std::size_t chunk_size = chunkSize(threads);
+        std::vector<std::thread> workers;
+        for(std::size_t begin = chunk_size ; begin < size_ ; begin += chunk_size) {
+            const std::size_t end = std::min(begin + chunk_size, size_);
+            workers.emplace_back([&function, begin, end](){function(begin, end);});
+        }
+        function(0, std::min(chunk_size, size_));
+        for(auto &w : workers)
+            w.join();
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_MEMBER_VIEW_HPP
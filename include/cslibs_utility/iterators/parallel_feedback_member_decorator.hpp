@@ -0,0 +1,169 @@
+#ifndef CSLIBS_UTILITY_PARALLEL_FEEDBACK_MEMBER_DECORATOR_HPP
+#define CSLIBS_UTILITY_PARALLEL_FEEDBACK_MEMBER_DECORATOR_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/common/delegate.hpp>
+#include <cslibs_utility/concurrency/thread_pool.hpp>
+#include <cslibs_utility/iterators/member_iterator.hpp>
+
+namespace cslibs_utility {
+namespace iterators {
+/**
+ * @brief The ParallelFeedbackMemberDecorator class is the parallel counterpart of the
+ *        FeedbackMemberDecorator. The data is split into disjoint sub-ranges, one per
+ *        thread, and each thread reports the members it accessed to its own Partial
+ *        sink, so no locking is needed. The partial results are merged in order before
+ *        the finished callback receives the result. The sub-ranges are processed
+ *        by threads spawned for each pass or by the workers of a shared pool.
+ *
+ *        Partial has to be default constructible and provide
+ *          void update(const T &t);            /// called for each accessed member
+ *          void merge(const Partial &other);   /// reduction of two partial results
+ */
+template<typename data_t, typename container_t, typename T, T data_t::*Member, typename Partial>
+class ParallelFeedbackMemberDecorator {
+public:
+    using iterator_t      = MemberIterator<data_t, T, Member>;
+    using notify_touch    = common::delegate<void()>;
+    using notify_finished = common::delegate<void(const Partial&)>;
+
+    ParallelFeedbackMemberDecorator(container_t        &data,
+                                    const std::size_t   threads,
+                                    notify_touch        touch,
+                                    notify_finished     finished) :
+        data_(data),
+        threads_(std::max<std::size_t>(threads, 1)),
+        pool_(nullptr),
+        untouched_(true),
+        touch_(touch),
+        finished_(finished)
+    {
+    }
+
+    ParallelFeedbackMemberDecorator(container_t        &data,
+                                    const std::size_t   threads,
+                                    notify_finished     finished) :
+        ParallelFeedbackMemberDecorator(data, threads, [](){return;}, finished)
+    {
+    }
+
+    /**
+     * @brief Constructor processing the sub-ranges on the workers of pool, the
+     *        calling thread takes part.
+     */
+    ParallelFeedbackMemberDecorator(container_t               &data,
+                                    concurrency::thread_pool  &pool,
+                                    notify_touch               touch,
+                                    notify_finished            finished) :
+        data_(data),
+        threads_(pool.size() + 1),
+        pool_(&pool),
+        untouched_(true),
+        touch_(touch),
+        finished_(finished)
+    {
+    }
+
+    ParallelFeedbackMemberDecorator(container_t               &data,
+                                    concurrency::thread_pool  &pool,
+                                    notify_finished            finished) :
+        ParallelFeedbackMemberDecorator(data, pool, [](){return;}, finished)
+    {
+    }
+
+    virtual ~ParallelFeedbackMemberDecorator()
+    {
+        if(!untouched_)
+            finished_(result_);
+    }
+
+    /**
+     * @brief Apply function to each member in parallel and report the modified
+     *        members to the partial sinks.
+     * @param function  - called as function(T &member)
+     */
+    template<typename Function>
+    inline void forEach(Function &&function)
+    {
+        forEachRange([&function](iterator_t begin, iterator_t end, Partial &partial) {
+            for(; begin != end ; ++begin) {
+                function(*begin);
+                partial.update(*begin);
+            }
+        });
+    }
+
+    /**
+     * @brief Process the sub-ranges in parallel, function is responsible for
+     *        reporting to the partial sink.
+     * @param function  - called as function(iterator_t begin, iterator_t end, Partial &partial)
+     */
+    template<typename Function>
+    inline void forEachRange(Function &&function)
+    {
+        if(untouched_) {
+            untouched_ = false;
+            touch_();
+        }
+
+        data_t *data = std::data(data_);
+        const std::size_t size   = std::size(data_);
+        const std::size_t chunk  = std::max<std::size_t>((size + threads_ - 1) / threads_, 1);
+        const std::size_t chunks = (size + chunk - 1) / chunk;
+
+        /// each thread updates a partial on its own stack and stores it once,
+        /// adjacent partials would share cache lines otherwise
+        std::vector<Partial> partials(chunks);
+        auto run = [&function, &partials, data, size, chunk](const std::size_t c) {
+            Partial partial;
+            function(iterator_t(data + c * chunk),
+                     iterator_t(data + std::min((c + 1) * chunk, size)),
+                     partial);
+            partials[c] = std::move(partial);
+        };
+        if(pool_) {
+            pool_->parallel_for(0, chunks, run, 1);
+        } else {
+            std::vector<std::thread> workers;
+            for(std::size_t c = 1 ; c < chunks ; ++c)
+                workers.emplace_back(run, c);
+            if(chunks > 0)
+                run(0);
+            for(auto &w : workers)
+                w.join();
+        }
+
+        for(const Partial &p : partials)
+            result_.merge(p);
+    }
+
+    /**
+     * @brief The merged result of all passes so far.
+     */
+    inline const Partial& getResult() const
+    {
+        return result_;
+    }
+
+    inline const container_t& getData() const
+    {
+        return data_;
+    }
+
+private:
+    container_t               &data_;      /// the container to be iterated
+    const std::size_t          threads_;
+    concurrency::thread_pool  *pool_;     /// runs the sub-ranges if set
+    bool                       untouched_;
+    notify_touch               touch_;     /// notify wether the data is in use or not
+    notify_finished            finished_;
+    Partial                    result_;    /// merged partial results
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_PARALLEL_FEEDBACK_MEMBER_DECORATOR_HPP
@@ -0,0 +1,354 @@
+#ifndef CSLIBS_UTILITY_ASYNC_WRITER_HPP
+#define CSLIBS_UTILITY_ASYNC_WRITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cslibs_utility/logger/row_ring_buffer.hpp>
+#include <cslibs_utility/logger/segment_sink.hpp>
+#include <cslibs_utility/metrics/metrics.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+struct AsyncWriterOptions {
+  /// number of pending rows after which the worker is woken up
+  std::size_t batch_size = 1024;
+  /// maximum time rows stay in memory before they are written to disk
+  std::chrono::milliseconds flush_interval{100};
+  /// number of slots of the lock-free ring backend, zero selects the mutex
+  /// protected chunk backend
+  std::size_t ring_capacity = 0;
+  /// maximum size of a single row in bytes for the ring backend
+  std::size_t ring_slot_size = 256;
+  /// what to do with rows if the ring backend is full
+  OverflowPolicy overflow_policy = OverflowPolicy::DropNewest;
+  /// bytes after which a new segment is started, zero disables
+  std::size_t rotate_size = 0;
+  /// age after which a new segment is started, zero disables
+  std::chrono::seconds rotate_interval{0};
+  /// number of segments kept on disk, the oldest ones are removed, zero keeps
+  /// all of them
+  std::size_t max_segments = 0;
+  /// streaming compression of each segment
+  Compression compression = Compression::None;
+  /// compression level, zero selects the library default
+  int compression_level = 0;
+};
+
+/**
+ * @brief The AsyncWriter class is the output backend shared by the loggers.
+ *        Producers append pre-formatted rows to an active chunk, a worker
+ *        thread swaps out the whole chunk under a single lock acquisition and
+ *        writes it to disk with one large write.
+ *        Alternatively, rows can be handed over through a bounded lock-free
+ *        ring buffer, in which case producers never take a lock and never
+ *        notify the worker, which then polls within the flush interval.
+ *        The output can be rotated by size or age, the first segment is
+ *        written to path, segment i > 0 to path with ".i" inserted before
+ *        the extension, e.g. log.csv, log.1.csv, .... Each segment starts
+ *        with the preamble. Rotation and compression happen on the worker
+ *        thread. Segments are switched between the chunks swapped out, so
+ *        rows are never split and a segment exceeds rotate_size by at most
+ *        one chunk.
+ */
+class AsyncWriter {
+ public:
+  using Options = AsyncWriterOptions;
+
+  /**
+   * @brief AsyncWriter constructor.
+   * @param path      - the output file
+   * @param preamble  - data written once before any row, e.g. a header
+   * @param options   - batching and backend options
+   */
+  inline AsyncWriter(const std::string &path, const std::string &preamble,
+                     const Options &options = Options())
+      : path_(path),
+        preamble_(preamble),
+        options_(options),
+        pending_rows_(0),
+        stop_(false),
+        wake_(false),
+        failed_(false),
+        dropped_(0),
+        segments_(0),
+        segment_bytes_(0) {
+    if (options_.ring_capacity > 0) {
+      ring_.reset(new RowRingBuffer(options_.ring_capacity,
+                                    options_.ring_slot_size,
+                                    options_.overflow_policy));
+    }
+    worker_thread_ = std::thread([this] { loop(); });
+  }
+
+  inline virtual ~AsyncWriter() {
+    if (worker_thread_.joinable()) {
+      {
+        std::unique_lock<std::mutex> q_lock(q_mutex_);
+        stop_ = true;
+      }
+      notify_log_.notify_one();
+      worker_thread_.join();
+    }
+  }
+
+  AsyncWriter(const AsyncWriter &other) = delete;
+  AsyncWriter &operator=(const AsyncWriter &other) = delete;
+
+  /**
+   * @brief Append a row. With the chunk backend the worker is only notified
+   *        once a full batch is pending, otherwise the rows are picked up
+   *        within the flush interval. With the ring backend the overflow
+   *        policy is applied.
+   * @param data  - the row data including its delimiter
+   * @param size  - the size of the row in bytes
+   * @return whether the row was accepted
+   */
+  inline bool append(const char *data, const std::size_t size) {
+    return countRow(appendRow(data, size));
+  }
+
+  inline bool append(const std::string &row) {
+    return append(row.data(), row.size());
+  }
+
+  /**
+   * @brief Append a row without ever blocking. The ring backend applies the
+   *        overflow policy, where blocking is replaced by dropping the row.
+   *        The chunk backend drops the row if the chunk is currently locked.
+   * @param data  - the row data including its delimiter
+   * @param size  - the size of the row in bytes
+   * @return whether the row was accepted
+   */
+  inline bool tryAppend(const char *data, const std::size_t size) {
+    return countRow(tryAppendRow(data, size));
+  }
+
+  inline bool tryAppend(const std::string &row) {
+    return tryAppend(row.data(), row.size());
+  }
+
+  /**
+   * @brief Number of rows which were dropped instead of written.
+   */
+  inline std::size_t dropped() const {
+    return dropped_.load(std::memory_order_relaxed) +
+           (ring_ ? ring_->dropped() : 0);
+  }
+
+  inline std::string const &path() const { return path_; }
+
+  inline Options const &options() const { return options_; }
+
+  /**
+   * @brief Number of segments started so far.
+   */
+  inline std::size_t segments() const {
+    return segments_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief The path of segment i, without the compression suffix.
+   */
+  inline std::string segmentPath(const std::size_t i) const {
+    if (i == 0) return path_;
+    const std::size_t slash = path_.find_last_of('/');
+    const std::size_t dot = path_.find_last_of('.');
+    const std::size_t insert =
+        (dot == std::string::npos ||
+         (slash != std::string::npos && dot < slash) || dot == slash + 1)
+            ? path_.size()
+            : dot;
+    return path_.substr(0, insert) + "." + std::to_string(i) +
+           path_.substr(insert);
+  }
+
+ private:
+  SegmentSink::Ptr out_;
+  std::string path_;
+  std::string preamble_;
+  Options options_;
+
+  std::thread worker_thread_;
+  std::mutex q_mutex_;
+  std::string q_;
+  std::unique_ptr<RowRingBuffer> ring_;
+  std::size_t pending_rows_;
+  std::condition_variable notify_log_;
+  bool stop_;
+  bool wake_;
+  std::atomic_bool failed_;
+  std::atomic<std::size_t> dropped_;
+  std::atomic<std::size_t> segments_;
+  std::size_t segment_bytes_;
+  std::chrono::steady_clock::time_point segment_start_;
+  std::deque<std::string> segment_files_;
+
+  inline bool appendChunk(std::unique_lock<std::mutex> &q_lock,
+                          const char *data, const std::size_t size) {
+    if (failed_) return false;
+    q_.append(data, size);
+    if (++pending_rows_ == options_.batch_size) {
+      q_lock.unlock();
+      notify_log_.notify_one();
+    }
+    return true;
+  }
+
+  inline bool appendRow(const char *data, const std::size_t size) {
+    if (ring_) {
+      if (failed_.load(std::memory_order_relaxed)) return false;
+      if (ring_->tryPush(data, size)) return true;
+      if (ring_->policy() == OverflowPolicy::Block) {
+        wakeUp();
+      }
+      return ring_->push(data, size);
+    }
+
+    std::unique_lock<std::mutex> q_lock(q_mutex_);
+    return appendChunk(q_lock, data, size);
+  }
+
+  inline bool tryAppendRow(const char *data, const std::size_t size) {
+    if (ring_) {
+      if (failed_.load(std::memory_order_relaxed)) return false;
+      if (ring_->policy() != OverflowPolicy::Block) {
+        return ring_->push(data, size);
+      }
+      if (ring_->tryPush(data, size)) return true;
+    } else {
+      std::unique_lock<std::mutex> q_lock(q_mutex_, std::try_to_lock);
+      if (q_lock.owns_lock()) {
+        return appendChunk(q_lock, data, size);
+      }
+    }
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  /// counts the accepted rows, rows per second follow from two snapshots
+  static inline bool countRow(const bool accepted) {
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+    static const metrics::Counter rows("logger.writer.rows");
+    if (accepted) rows.record(1);
+#endif
+    return accepted;
+  }
+
+  inline void wakeUp() {
+    {
+      std::unique_lock<std::mutex> q_lock(q_mutex_);
+      wake_ = true;
+    }
+    notify_log_.notify_one();
+  }
+
+  bool openSegment() {
+    const std::size_t segment = segments_.load(std::memory_order_relaxed);
+    const std::string path = segmentPath(segment);
+    out_ = SegmentSink::open(path, options_.compression,
+                             options_.compression_level);
+    if (!out_->isOpen()) {
+      std::cerr << "[AsyncWriter]: Could not open path '" << path << "'!\n";
+      return false;
+    }
+    out_->write(preamble_.data(), preamble_.size());
+    segments_.store(segment + 1, std::memory_order_relaxed);
+    segment_bytes_ = 0;
+    segment_start_ = std::chrono::steady_clock::now();
+
+    if (options_.max_segments > 0) {
+      segment_files_.emplace_back(
+          path + (compressionAvailable(options_.compression)
+                      ? compressionSuffix(options_.compression)
+                      : ""));
+      while (segment_files_.size() > options_.max_segments) {
+        std::remove(segment_files_.front().c_str());
+        segment_files_.pop_front();
+      }
+    }
+    return true;
+  }
+
+  inline bool rotationDue() const {
+    return (options_.rotate_size > 0 &&
+            segment_bytes_ >= options_.rotate_size) ||
+           (options_.rotate_interval.count() > 0 &&
+            std::chrono::steady_clock::now() - segment_start_ >=
+                options_.rotate_interval);
+  }
+
+  /// nothing is drained anymore, producers blocked on the ring drop instead
+  inline void fail() {
+    {
+      std::unique_lock<std::mutex> q_lock(q_mutex_);
+      failed_ = true;
+      q_.clear();
+    }
+    if (ring_) ring_->close();
+  }
+
+  void loop() {
+    if (!openSegment()) {
+      fail();
+      return;
+    }
+
+    /// q_ and chunk are swapped, so that both buffers keep their capacity
+    std::string chunk;
+    auto ready = [this]() {
+      return stop_ || wake_ || pending_rows_ >= options_.batch_size;
+    };
+    auto collect = [&chunk](const char *data, const std::size_t size) {
+      chunk.append(data, size);
+    };
+
+    std::unique_lock<std::mutex> q_lock(q_mutex_);
+    bool running = true;
+    while (running) {
+      notify_log_.wait_for(q_lock, options_.flush_interval, ready);
+      running = !stop_;
+      wake_ = false;
+      q_.swap(chunk);
+      pending_rows_ = 0;
+      q_lock.unlock();
+
+      if (ring_) {
+        ring_->drain(collect);
+      }
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+      static const metrics::HighWater backlog("logger.writer.backlog_bytes");
+      backlog.record(chunk.size());
+#endif
+      if (!chunk.empty()) {
+        out_->write(chunk.data(), chunk.size());
+        segment_bytes_ += chunk.size();
+        chunk.clear();
+      }
+      /// producers keep appending to q_ while the segment is switched
+      if (running && rotationDue()) {
+        out_->close();
+        if (!openSegment()) {
+          fail();
+          return;
+        }
+      }
+      q_lock.lock();
+    }
+    q_lock.unlock();
+
+    out_->close();
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_ASYNC_WRITER_HPP
@@ -0,0 +1,197 @@
+#ifndef CSLIBS_UTILITY_BINARY_FORMAT_HPP
+#define CSLIBS_UTILITY_BINARY_FORMAT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Binary log layout, all numbers are little-endian:
+ *
+ *   magic     4 bytes   "CSLB"
+ *   version   uint32
+ *   columns   uint32
+ *   columns times:
+ *     type    uint8     BinaryType
+ *     length  uint32    length of the column name
+ *     name    length bytes
+ *   records   fixed width, the columns are packed without padding
+ */
+namespace cslibs_utility {
+namespace logger {
+enum class BinaryType : std::uint8_t {
+  Bool = 0,
+  Int8 = 1,
+  UInt8 = 2,
+  Int16 = 3,
+  UInt16 = 4,
+  Int32 = 5,
+  UInt32 = 6,
+  Int64 = 7,
+  UInt64 = 8,
+  Float32 = 9,
+  Float64 = 10
+};
+
+constexpr char binary_magic[4] = {'C', 'S', 'L', 'B'};
+constexpr std::uint32_t binary_version = 1;
+
+/**
+ * @brief Type tag of a column type, only fixed width arithmetic types are
+ *        supported.
+ */
+template <typename T>
+constexpr BinaryType binaryTypeOf() {
+  static_assert(std::is_arithmetic<T>::value,
+                "Binary logs only support arithmetic column types.");
+  if constexpr (std::is_same<T, bool>::value) {
+    return BinaryType::Bool;
+  } else if constexpr (std::is_floating_point<T>::value) {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+                  "Binary logs only support 32 and 64 bit floating point.");
+    return sizeof(T) == 4 ? BinaryType::Float32 : BinaryType::Float64;
+  } else {
+    constexpr bool is_signed = std::is_signed<T>::value;
+    switch (sizeof(T)) {
+      case 1:
+        return is_signed ? BinaryType::Int8 : BinaryType::UInt8;
+      case 2:
+        return is_signed ? BinaryType::Int16 : BinaryType::UInt16;
+      case 4:
+        return is_signed ? BinaryType::Int32 : BinaryType::UInt32;
+      default:
+        return is_signed ? BinaryType::Int64 : BinaryType::UInt64;
+    }
+  }
+}
+
+/**
+ * @brief Size of a column type tag in bytes, zero for unknown tags.
+ */
+inline std::size_t binarySizeOf(const BinaryType type) {
+  switch (type) {
+    case BinaryType::Bool:
+    case BinaryType::Int8:
+    case BinaryType::UInt8:
+      return 1;
+    case BinaryType::Int16:
+    case BinaryType::UInt16:
+      return 2;
+    case BinaryType::Int32:
+    case BinaryType::UInt32:
+    case BinaryType::Float32:
+      return 4;
+    case BinaryType::Int64:
+    case BinaryType::UInt64:
+    case BinaryType::Float64:
+      return 8;
+  }
+  return 0;
+}
+
+/**
+ * @brief Copy size bytes and convert from host to little-endian byte order
+ *        or vice versa.
+ */
+inline void copyLittleEndian(char *dst, const char *src, const std::size_t size) {
+  std::memcpy(dst, src, size);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  std::reverse(dst, dst + size);
+#endif
+}
+
+/**
+ * @brief Append a value in little-endian byte order.
+ */
+template <typename T>
+inline void appendBinary(std::string &buffer, const T &t) {
+  if constexpr (std::is_same<T, bool>::value) {
+    buffer.push_back(t ? 1 : 0);
+  } else {
+    char tmp[sizeof(T)];
+    copyLittleEndian(tmp, reinterpret_cast<const char *>(&t), sizeof(T));
+    buffer.append(tmp, sizeof(T));
+  }
+}
+
+/**
+ * @brief Read a value stored in little-endian byte order.
+ */
+template <typename T>
+inline T readBinary(const char *data) {
+  if constexpr (std::is_same<T, bool>::value) {
+    return *data != 0;
+  } else {
+    T t;
+    copyLittleEndian(reinterpret_cast<char *>(&t), data, sizeof(T));
+    return t;
+  }
+}
+
+struct BinaryColumn {
+  BinaryType type;
+  std::string name;
+};
+
+/**
+ * @brief Encode the self-describing file header.
+ * @param columns - column type tags and names
+ * @return the encoded header
+ */
+inline std::string encodeBinaryHeader(const std::vector<BinaryColumn> &columns) {
+  std::string header(binary_magic, sizeof(binary_magic));
+  appendBinary(header, binary_version);
+  appendBinary(header, static_cast<std::uint32_t>(columns.size()));
+  for (const auto &c : columns) {
+    appendBinary(header, static_cast<std::uint8_t>(c.type));
+    appendBinary(header, static_cast<std::uint32_t>(c.name.size()));
+    header.append(c.name);
+  }
+  return header;
+}
+
+/**
+ * @brief Decode the self-describing file header.
+ * @param in      - the input stream positioned at the start of the file
+ * @param columns - the decoded column type tags and names
+ * @return false if the stream does not start with a valid header
+ */
+inline bool decodeBinaryHeader(std::istream &in,
+                               std::vector<BinaryColumn> &columns) {
+  auto read = [&in](auto &value) {
+    char tmp[sizeof(value)];
+    if (!in.read(tmp, sizeof(tmp))) return false;
+    value = readBinary<typename std::decay<decltype(value)>::type>(tmp);
+    return true;
+  };
+
+  char magic[sizeof(binary_magic)];
+  if (!in.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, binary_magic, sizeof(magic)) != 0) {
+    return false;
+  }
+  std::uint32_t version, size;
+  if (!read(version) || version != binary_version || !read(size)) {
+    return false;
+  }
+
+  columns.resize(size);
+  for (auto &c : columns) {
+    std::uint8_t type;
+    std::uint32_t length;
+    if (!read(type) || !read(length)) return false;
+    c.type = static_cast<BinaryType>(type);
+    if (binarySizeOf(c.type) == 0) return false;
+    c.name.resize(length);
+    if (!in.read(&c.name[0], length)) return false;
+  }
+  return true;
+}
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_BINARY_FORMAT_HPP
@@ -0,0 +1,119 @@
+#ifndef CSLIBS_UTILITY_BINARY_READER_HPP
+#define CSLIBS_UTILITY_BINARY_READER_HPP
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <cslibs_utility/logger/binary_format.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The BinaryReader class reads logs written by BinaryWriter. The
+ *        column types stored in the file header have to match Types...,
+ *        otherwise no data is read.
+ */
+template <typename... Types>
+class BinaryReader {
+ public:
+  using Ptr = std::unique_ptr<BinaryReader<Types...>>;
+
+  static constexpr std::size_t size = sizeof...(Types);
+  static constexpr std::size_t record_size = (sizeof(Types) + ...);
+  using header_t = std::array<std::string, size>;
+  using entry_t = std::tuple<Types...>;
+  using data_t = std::vector<entry_t>;
+
+  inline explicit BinaryReader(const std::string &path)
+      : in_{path, std::ios::binary} {read();}
+  inline virtual ~BinaryReader() = default;
+
+  inline bool hasHeader() const { return header_.has_value(); }
+
+  inline header_t const &getHeader() const { return header_.value(); }
+
+  inline data_t const &getData() const { return data_; }
+
+  /// whether the file ended within a record, which was dropped
+  inline bool isTruncated() const { return truncated_; }
+
+ private:
+  /// records are read in blocks of this size
+  static constexpr std::size_t block_records = 4096;
+
+  std::ifstream in_;
+  std::optional<header_t> header_;
+  data_t data_;
+  bool truncated_ = false;
+
+  void read() {
+    if (!in_.is_open()) {
+      return;
+    }
+
+    std::vector<BinaryColumn> columns;
+    if (!decodeBinaryHeader(in_, columns)) {
+      std::cerr << "[BinaryReader]: Could not read header." << std::endl;
+      return;
+    }
+    const std::array<BinaryType, size> types = {binaryTypeOf<Types>()...};
+    if (columns.size() != size) {
+      std::cerr << "[BinaryReader]: Column count does not match." << std::endl;
+      return;
+    }
+    header_ = header_t();
+    for (std::size_t i = 0; i < size; ++i) {
+      if (columns[i].type != types[i]) {
+        std::cerr << "[BinaryReader]: Type of column '" << columns[i].name
+                  << "' does not match." << std::endl;
+        header_.reset();
+        return;
+      }
+      header_.value()[i] = columns[i].name;
+    }
+
+    /// reserve all records at once, the records follow the header
+    const std::streampos records_begin = in_.tellg();
+    in_.seekg(0, std::ios::end);
+    const std::streamoff bytes = in_.tellg() - records_begin;
+    in_.seekg(records_begin);
+    if (bytes > 0) {
+      data_.reserve(static_cast<std::size_t>(bytes) / record_size);
+    }
+
+    std::vector<char> block(block_records * record_size);
+    while (in_) {
+      in_.read(block.data(), static_cast<std::streamsize>(block.size()));
+      const std::size_t read = static_cast<std::size_t>(in_.gcount());
+      const std::size_t records = read / record_size;
+      for (std::size_t r = 0; r < records; ++r) {
+        data_.emplace_back(decode(block.data() + r * record_size,
+                                  std::index_sequence_for<Types...>()));
+      }
+      if (read % record_size != 0) {
+        std::cerr << "[BinaryReader]: File is truncated, the last record is "
+                     "incomplete." << std::endl;
+        truncated_ = true;
+      }
+    }
+  }
+
+  template <std::size_t... I>
+  static inline entry_t decode(const char *record, std::index_sequence<I...>) {
+    constexpr std::array<std::size_t, size> sizes = {sizeof(Types)...};
+    std::array<std::size_t, size> offsets{};
+    for (std::size_t i = 1; i < size; ++i) {
+      offsets[i] = offsets[i - 1] + sizes[i - 1];
+    }
+    return entry_t(readBinary<Types>(record + offsets[I])...);
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_BINARY_READER_HPP
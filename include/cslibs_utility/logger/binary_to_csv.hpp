@@ -0,0 +1,119 @@
+#ifndef CSLIBS_UTILITY_BINARY_TO_CSV_HPP
+#define CSLIBS_UTILITY_BINARY_TO_CSV_HPP
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cslibs_utility/logger/binary_format.hpp>
+#include <cslibs_utility/logger/csv_formatter.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+namespace detail {
+inline void appendBinaryField(std::string &buffer, const BinaryType type,
+                              const char *data) {
+  switch (type) {
+    case BinaryType::Bool:
+      appendField(buffer, readBinary<bool>(data));
+      break;
+    case BinaryType::Int8:
+      appendField(buffer, readBinary<std::int8_t>(data));
+      break;
+    case BinaryType::UInt8:
+      appendField(buffer, readBinary<std::uint8_t>(data));
+      break;
+    case BinaryType::Int16:
+      appendField(buffer, readBinary<std::int16_t>(data));
+      break;
+    case BinaryType::UInt16:
+      appendField(buffer, readBinary<std::uint16_t>(data));
+      break;
+    case BinaryType::Int32:
+      appendField(buffer, readBinary<std::int32_t>(data));
+      break;
+    case BinaryType::UInt32:
+      appendField(buffer, readBinary<std::uint32_t>(data));
+      break;
+    case BinaryType::Int64:
+      appendField(buffer, readBinary<std::int64_t>(data));
+      break;
+    case BinaryType::UInt64:
+      appendField(buffer, readBinary<std::uint64_t>(data));
+      break;
+    case BinaryType::Float32:
+      appendField(buffer, readBinary<float>(data));
+      break;
+    case BinaryType::Float64:
+      appendField(buffer, readBinary<double>(data));
+      break;
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Convert a binary log into CSV. The conversion is driven by the type
+ *        tags of the file header, thus the column types need not be known at
+ *        compile time.
+ * @param binary_path - the binary log to be read
+ * @param csv_path    - the CSV file to be written, including a header line
+ * @return false if the binary log could not be read, is truncated or the CSV
+ *         not written, the complete records are converted anyway
+ */
+inline bool convertBinaryToCSV(const std::string &binary_path,
+                               const std::string &csv_path) {
+  std::ifstream in(binary_path, std::ios::binary);
+  std::vector<BinaryColumn> columns;
+  if (!in.is_open() || !decodeBinaryHeader(in, columns) || columns.empty()) {
+    std::cerr << "[convertBinaryToCSV]: Could not read header of '"
+              << binary_path << "'." << std::endl;
+    return false;
+  }
+  std::ofstream out(csv_path, std::ios::binary);
+  if (!out.is_open()) {
+    std::cerr << "[convertBinaryToCSV]: Could not open path '" << csv_path
+              << "'." << std::endl;
+    return false;
+  }
+
+  std::string buffer;
+  std::size_t record_size = 0;
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    if (i > 0) buffer.push_back(',');
+    buffer.append(columns[i].name);
+    record_size += binarySizeOf(columns[i].type);
+  }
+  buffer.push_back('\n');
+
+  constexpr std::size_t block_records = 4096;
+  std::vector<char> block(block_records * record_size);
+  bool truncated = false;
+  while (in) {
+    in.read(block.data(), static_cast<std::streamsize>(block.size()));
+    const std::size_t read = static_cast<std::size_t>(in.gcount());
+    const std::size_t records = read / record_size;
+    truncated = truncated || read % record_size != 0;
+    for (std::size_t r = 0; r < records; ++r) {
+      const char *field = block.data() + r * record_size;
+      for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (i > 0) buffer.push_back(',');
+        detail::appendBinaryField(buffer, columns[i].type, field);
+        field += binarySizeOf(columns[i].type);
+      }
+      buffer.push_back('\n');
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+  }
+  if (truncated) {
+    std::cerr << "[convertBinaryToCSV]: '" << binary_path
+              << "' is truncated, the last record is incomplete." << std::endl;
+    return false;
+  }
+  return static_cast<bool>(out);
+}
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_BINARY_TO_CSV_HPP
@@ -0,0 +1,93 @@
+#ifndef CSLIBS_UTILITY_BINARY_WRITER_HPP
+#define CSLIBS_UTILITY_BINARY_WRITER_HPP
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include <cslibs_utility/logger/async_writer.hpp>
+#include <cslibs_utility/logger/binary_format.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The BinaryWriter class is the binary counterpart of CSVWriter. The
+ *        file starts with a self-describing header, followed by fixed width
+ *        little-endian records, see binary_format.hpp.
+ */
+template <typename... Types>
+class BinaryWriter {
+ public:
+  using Ptr = std::shared_ptr<BinaryWriter<Types...>>;
+
+  static constexpr std::size_t size = sizeof...(Types);
+  static constexpr std::size_t record_size = (sizeof(Types) + ...);
+  using header_t = std::array<std::string, size>;
+  using options_t = AsyncWriter::Options;
+
+  inline void write(const Types &... ts) {
+    out_.append(encode(ts...));
+  }
+
+  /**
+   * @brief Write a record without ever blocking the caller, the record is
+   *        dropped instead.
+   * @param ts  - the column values
+   * @return whether the record was accepted
+   */
+  inline bool tryWrite(const Types &... ts) {
+    return out_.tryAppend(encode(ts...));
+  }
+
+  inline BinaryWriter(const header_t &header, const std::string &path,
+                      const options_t &options = options_t())
+      : out_(path, buildHeader(header), adapt(options)) {}
+
+  inline BinaryWriter(const std::string &path,
+                      const options_t &options = options_t())
+      : out_(path, buildHeader(header_t()), adapt(options)) {}
+
+  virtual ~BinaryWriter() = default;
+
+  inline std::string const & path() const
+  {
+    return out_.path();
+  }
+
+  /**
+   * @brief Number of records which were dropped instead of written.
+   */
+  inline std::size_t dropped() const
+  {
+    return out_.dropped();
+  }
+
+ private:
+  AsyncWriter out_;
+
+  static inline std::string const &encode(const Types &... ts) {
+    thread_local std::string record;
+    record.clear();
+    (appendBinary(record, ts), ...);
+    return record;
+  }
+
+  static inline std::string buildHeader(const header_t &header) {
+    const std::array<BinaryType, size> types = {binaryTypeOf<Types>()...};
+    std::vector<BinaryColumn> columns(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      columns[i].type = types[i];
+      columns[i].name = header[i];
+    }
+    return encodeBinaryHeader(columns);
+  }
+
+  static inline options_t adapt(options_t options) {
+    options.ring_slot_size = std::max(options.ring_slot_size, record_size);
+    return options;
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_BINARY_WRITER_HPP
@@ -0,0 +1,89 @@
+#ifndef CSLIBS_UTILITY_CSV_CLOCK_HPP
+#define CSLIBS_UTILITY_CSV_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief Timestamp sources for CSVLogger. A clock provides
+ *          static std::int64_t now();
+ *        the count of its duration_t since its epoch, which is written as a
+ *        plain integer column.
+ */
+template<typename Clock, typename Duration>
+struct ChronoClock {
+    using duration_t = Duration;
+
+    static inline std::int64_t now()
+    {
+        return static_cast<std::int64_t>(
+                    std::chrono::duration_cast<Duration>(Clock::now().time_since_epoch()).count());
+    }
+};
+
+/// wall clock time since the unix epoch
+template<typename Duration = std::chrono::microseconds>
+using SystemClock = ChronoClock<std::chrono::system_clock, Duration>;
+
+/// monotonic time, the epoch is unspecified, usually the boot time
+template<typename Duration = std::chrono::microseconds>
+using SteadyClock = ChronoClock<std::chrono::steady_clock, Duration>;
+
+/**
+ * @brief The TSCClock class reads the time stamp counter, which is cheaper
+ *        than a clock_gettime call. The counter is calibrated against the
+ *        steady clock once on first use, which takes about 10ms, and mapped
+ *        onto its epoch. An invariant TSC is assumed, as found on all recent
+ *        x86 CPUs. On other architectures the steady clock is used.
+ */
+template<typename Duration = std::chrono::nanoseconds>
+class TSCClock {
+public:
+    using duration_t = Duration;
+
+    static inline std::int64_t now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        static const calibration c = calibrate();
+        const double ticks = static_cast<double>(__rdtsc() - c.tsc);
+        return c.offset + static_cast<std::int64_t>(ticks * c.scale);
+#else
+        return SteadyClock<Duration>::now();
+#endif
+    }
+
+private:
+    struct calibration {
+        unsigned long long  tsc;
+        std::int64_t        offset;  /// steady time at tsc
+        double              scale;   /// duration_t per tick
+    };
+
+#if defined(__x86_64__) || defined(__i386__)
+    static inline calibration calibrate()
+    {
+        using steady_t = std::chrono::steady_clock;
+        const steady_t::time_point  t0   = steady_t::now();
+        const unsigned long long    tsc0 = __rdtsc();
+        steady_t::time_point        t1   = t0;
+        while(t1 - t0 < std::chrono::milliseconds(10))
+            t1 = steady_t::now();
+        const unsigned long long    tsc1 = __rdtsc();
+
+        const double elapsed = std::chrono::duration<double, typename Duration::period>(t1 - t0).count();
+        return calibration{tsc0,
+                           static_cast<std::int64_t>(std::chrono::duration_cast<Duration>(t0.time_since_epoch()).count()),
+                           elapsed / static_cast<double>(tsc1 - tsc0)};
+    }
+#endif
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_CSV_CLOCK_HPP
@@ -0,0 +1,162 @@
+#ifndef CSLIBS_UTILITY_CSV_COLUMN_READER_HPP
+#define CSLIBS_UTILITY_CSV_COLUMN_READER_HPP
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_parser.hpp>
+#include <cslibs_utility/logger/mapped_file.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The CSVColumnReader class reads a CSV file into a structure of
+ *        arrays, one contiguous vector per column, which is filled directly by
+ *        the parser. Column-wise reductions thus run over contiguous memory.
+ *        Rows are parsed like CSVReadMode::Mapped does.
+ */
+template <typename... Types>
+class CSVColumnReader {
+  static_assert(!(std::is_same<Types, bool>::value || ...),
+                "std::vector<bool> cannot be filled in place, use an integral "
+                "column type instead.");
+
+ public:
+  using Ptr = std::unique_ptr<CSVColumnReader<Types...>>;
+
+  static constexpr std::size_t size = sizeof...(Types);
+  using header_t = std::array<std::string, size>;
+  using columns_t = std::tuple<std::vector<Types>...>;
+  template <std::size_t I>
+  using column_t = typename std::tuple_element<I, columns_t>::type;
+
+  /**
+   * @brief CSVColumnReader constructor, the file is read completely.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param threads     - number of parsing threads, zero selects the hardware
+   *                      concurrency
+   */
+  inline explicit CSVColumnReader(const std::string &path,
+                                  const bool has_header = false,
+                                  const std::size_t threads = 1) {
+    read(path, has_header,
+         threads > 0 ? threads
+                     : std::max(1u, std::thread::hardware_concurrency()));
+  }
+
+  /**
+   * @brief CSVColumnReader constructor parsing on the workers of a shared
+   *        pool.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param pool        - the pool, the calling thread takes part
+   */
+  inline CSVColumnReader(const std::string &path, const bool has_header,
+                         concurrency::thread_pool &pool) {
+    read(path, has_header, pool.size() + 1, &pool);
+  }
+  inline virtual ~CSVColumnReader() = default;
+
+  inline bool hasHeader() const { return header_.has_value(); }
+
+  inline header_t const &getHeader() const { return header_.value(); }
+
+  inline columns_t const &getColumns() const { return columns_; }
+
+  template <std::size_t I>
+  inline column_t<I> const &getColumn() const {
+    return std::get<I>(columns_);
+  }
+
+  /**
+   * @brief Number of rows read.
+   */
+  inline std::size_t rows() const { return std::get<0>(columns_).size(); }
+
+ private:
+  using parser_t = CSVParser<Types...>;
+
+  std::optional<header_t> header_;
+  columns_t columns_;
+
+  void read(const std::string &path, const bool has_header,
+            const std::size_t threads,
+            concurrency::thread_pool *pool = nullptr) {
+    MappedFile file(path);
+    if (!file.isOpen()) {
+      return;
+    }
+    const char *pos = file.begin();
+    const char *end = file.end();
+    if (has_header) {
+      if (pos != end) {
+        parser_t::header(pos, end, header_.emplace());
+      } else {
+        std::cerr << "[CSVColumnReader]: Could not read header." << std::endl;
+      }
+    }
+
+    /// small files are not worth spawning threads for
+    constexpr std::size_t min_chunk_size = 1 << 20;
+    const std::size_t chunks = std::min(
+        threads, static_cast<std::size_t>(end - pos) / min_chunk_size + 1);
+    if (chunks <= 1) {
+      parseRange(pos, end, columns_);
+      return;
+    }
+
+    const auto ranges = splitChunks(pos, end, chunks);
+    std::vector<columns_t> chunk_columns(ranges.size());
+    parseChunks(ranges.size(), [&ranges, &chunk_columns](const std::size_t i) {
+      parseRange(ranges[i].first, ranges[i].second, chunk_columns[i]);
+    }, pool);
+
+    columns_ = std::move(chunk_columns[0]);
+    stitch(chunk_columns, std::index_sequence_for<Types...>());
+  }
+
+  template <std::size_t... I>
+  void stitch(std::vector<columns_t> &chunk_columns, std::index_sequence<I...>) {
+    std::size_t rows = 0;
+    for (const auto &c : chunk_columns) {
+      rows += std::get<0>(c).size();
+    }
+    (std::get<I>(columns_).reserve(rows), ...);
+    for (std::size_t c = 1; c < chunk_columns.size(); ++c) {
+      (std::get<I>(columns_).insert(
+           std::get<I>(columns_).end(),
+           std::make_move_iterator(std::get<I>(chunk_columns[c]).begin()),
+           std::make_move_iterator(std::get<I>(chunk_columns[c]).end())),
+       ...);
+    }
+  }
+
+  static void parseRange(const char *pos, const char *end, columns_t &columns) {
+    parseRange(pos, end, columns, std::index_sequence_for<Types...>());
+  }
+
+  template <std::size_t... I>
+  static void parseRange(const char *pos, const char *end, columns_t &columns,
+                         std::index_sequence<I...>) {
+    while (pos != end) {
+      const bool parsed = parser_t::parse(
+          pos, end, std::get<I>(columns).emplace_back()...);
+      if (!parsed) {
+        (std::get<I>(columns).pop_back(), ...);
+      }
+    }
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_COLUMN_READER_HPP
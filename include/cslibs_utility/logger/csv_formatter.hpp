@@ -0,0 +1,88 @@
+#ifndef CSLIBS_UTILITY_CSV_FORMATTER_HPP
+#define CSLIBS_UTILITY_CSV_FORMATTER_HPP
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace cslibs_utility {
+namespace logger {
+template <typename T>
+inline std::string toString(const T &t) {
+  return std::to_string(t);
+}
+
+template <>
+inline std::string toString<std::string>(const std::string &str) {
+  return str;
+}
+
+/**
+ * @brief Append the textual representation of a single field to a buffer.
+ *        Arithmetic types are written with std::to_chars, strings are copied
+ *        as they are, so neither allocates once the buffer has grown to its
+ *        steady state capacity. Any other type falls back to toString, which
+ *        can be specialized for custom column types.
+ * @param buffer  - the buffer to append to
+ * @param t       - the value to be appended
+ */
+template <typename T>
+inline void appendField(std::string &buffer, const T &t) {
+  if constexpr (std::is_same<T, bool>::value) {
+    buffer.push_back(t ? '1' : '0');
+  } else if constexpr (std::is_arithmetic<T>::value) {
+    char tmp[64];
+    const auto result = std::to_chars(tmp, tmp + sizeof(tmp), t);
+    buffer.append(tmp, result.ptr);
+  } else if constexpr (std::is_convertible<const T &, std::string_view>::value) {
+    buffer.append(std::string_view(t));
+  } else {
+    buffer.append(toString(t));
+  }
+}
+
+/**
+ * @brief The CSVFormatter class formats rows of Types... directly into a
+ *        caller provided character buffer. The column loop is unrolled at
+ *        compile time, so there is neither a recursion nor a temporary string
+ *        per column.
+ */
+template <typename... Types>
+class CSVFormatter {
+ public:
+  static constexpr std::size_t size = sizeof...(Types);
+  static constexpr char delimiter = ',';
+
+  /**
+   * @brief Append a row without the trailing newline to the buffer.
+   * @param buffer  - the buffer to append to
+   * @param ts      - the column values
+   */
+  static inline void format(std::string &buffer, const Types &... ts) {
+    format(buffer, std::index_sequence_for<Types...>(), ts...);
+  }
+
+  /**
+   * @brief Append a row including the trailing newline to the buffer.
+   * @param buffer  - the buffer to append to
+   * @param ts      - the column values
+   */
+  static inline void formatRow(std::string &buffer, const Types &... ts) {
+    format(buffer, ts...);
+    buffer.push_back('\n');
+  }
+
+ private:
+  template <std::size_t... I>
+  static inline void format(std::string &buffer, std::index_sequence<I...>,
+                            const Types &... ts) {
+    ((I > 0 ? buffer.push_back(delimiter) : void(), appendField(buffer, ts)),
+     ...);
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_FORMATTER_HPP
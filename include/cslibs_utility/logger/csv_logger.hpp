@@ -5,62 +5,98 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <thread>
 #include <atomic>
 #include <condition_variable>
 #include <queue>
 
+#include <cslibs_utility/logger/csv_clock.hpp>
 #include <cslibs_utility/logger/csv_writer.hpp>
 
 namespace cslibs_utility {
 namespace logger {
-template<typename ... Types>
-class CSVLogger {
+/**
+ * @brief The BasicCSVLogger class prepends a time column to each row, the
+ *        timestamp is taken from Clock, see csv_clock.hpp, and written as
+ *        integer count of Clock::duration_t.
+ */
+template<typename Clock, typename ... Types>
+class BasicCSVLogger {
 public:
-    using Ptr = std::shared_ptr<CSVLogger<Types ...>>;
+    using Ptr = std::shared_ptr<BasicCSVLogger<Clock, Types ...>>;
 
     static constexpr std::size_t size = sizeof ... (Types);
     using header_t = std::array<std::string, size>;
 
-    inline void log(const Types ... ts)
+    using clock_t = Clock;
+    using writer_t = CSVWriter<std::int64_t, Types ...>;
+    using options_t = typename writer_t::options_t;
+
+    inline void log(const Types &... ts)
     {
-        writer_->write(getTime(), ts...);
+        writer_->write(Clock::now(), ts...);
     }
 
-    inline CSVLogger(const header_t &header,
-                     const std::string &path = "")
+    /**
+     * @brief Log without ever blocking, the row is dropped instead.
+     * @param ts - the column values
+     * @return whether the row was accepted
+     */
+    inline bool tryLog(const Types &... ts)
     {
-        typename CSVWriter<std::string, Types ...>::header_t head;
-        head[0] = "time";
-        for(std::size_t i = 0 ; i < size ; ++i) {
-            head[i+1] = header[i];
-        }
-        writer_.reset(new CSVWriter<std::string, Types ...>(head, path == "" ? "/tmp/" + getTime() + ".log" : path));
+        return writer_->tryWrite(Clock::now(), ts...);
     }
 
-private:
-    typename CSVWriter<std::string, Types ...>::Ptr writer_;
+    /**
+     * @brief Log with a caller supplied timestamp, e.g. the stamp of the
+     *        sensor data logged, the clock is not read.
+     * @param stamp - the timestamp
+     * @param ts    - the column values
+     */
+    inline void logAt(const std::int64_t stamp, const Types &... ts)
+    {
+        writer_->write(stamp, ts...);
+    }
+
+    inline bool tryLogAt(const std::int64_t stamp, const Types &... ts)
+    {
+        return writer_->tryWrite(stamp, ts...);
+    }
 
-    inline void getTime(long &seconds,
-                        long &milliseconds)
+    /**
+     * @brief Number of rows which were dropped instead of written.
+     */
+    inline std::size_t dropped() const
     {
-        auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-        milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-        seconds = milliseconds / 1000;
-        milliseconds = milliseconds % 1000;
+        return writer_->dropped();
     }
 
-    inline std::string getTime()
+    inline std::string const & path() const
     {
-        long s, ms;
-        getTime(s, ms);
+        return writer_->path();
+    }
 
-        const std::string ms_off = ms >= 100 ? "" : (ms >= 10 ? "0" : "00");
-        const std::string time = std::to_string(s) + "." + ms_off + std::to_string(ms);
-        return time;
+    inline BasicCSVLogger(const header_t &header,
+                          const std::string &path = "",
+                          const options_t &options = options_t())
+    {
+        typename writer_t::header_t head;
+        head[0] = "time";
+        for(std::size_t i = 0 ; i < size ; ++i) {
+            head[i+1] = header[i];
+        }
+        writer_.reset(new writer_t(head, path == "" ? "/tmp/" + std::to_string(Clock::now()) + ".log" : path, options));
     }
+
+private:
+    typename writer_t::Ptr writer_;
 };
+
+/// logs the wall clock time in microseconds since the unix epoch
+template<typename ... Types>
+using CSVLogger = BasicCSVLogger<SystemClock<>, Types ...>;
 }
 }
 
@@ -0,0 +1,171 @@
+#ifndef CSLIBS_UTILITY_CSV_MERGE_READER_HPP
+#define CSLIBS_UTILITY_CSV_MERGE_READER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_stream_reader.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The BasicCSVMergeReader class replays several CSV files in the order
+ *        of a key column, e.g. the time column of a CSVLogger. The files are
+ *        read by CSVStreamReaders in a single sequential pass each, only the
+ *        next row of every file is kept in a heap, thus memory stays constant
+ *        regardless of the file sizes.
+ *        Each file has to be sorted by the key already, which holds for the
+ *        time column as long as the logger's clock is monotonic. Rows with
+ *        equal keys are returned in the order of the files passed.
+ */
+template <std::size_t Key, typename... Types>
+class BasicCSVMergeReader {
+ public:
+  using reader_t = CSVStreamReader<Types...>;
+  using entry_t = typename reader_t::entry_t;
+  using key_t = std::tuple_element_t<Key, entry_t>;
+
+  static constexpr std::size_t size = reader_t::size;
+
+  /**
+   * @brief The iterator class is an input iterator over the remaining rows in
+   *        key order. Incrementing it consumes a row of the reader.
+   */
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = entry_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const entry_t *;
+    using reference = const entry_t &;
+
+    iterator() : reader_(nullptr), source_(0) {}
+
+    explicit iterator(BasicCSVMergeReader *reader)
+        : reader_(reader), source_(0) {
+      ++(*this);
+    }
+
+    inline iterator &operator++() {
+      if (reader_ && !reader_->next(entry_, source_)) {
+        reader_ = nullptr;
+      }
+      return *this;
+    }
+
+    inline reference operator*() const { return entry_; }
+
+    inline pointer operator->() const { return &entry_; }
+
+    /**
+     * @brief The index of the file the current row was read from.
+     */
+    inline std::size_t source() const { return source_; }
+
+    inline bool operator==(const iterator &other) const {
+      return reader_ == other.reader_;
+    }
+
+    inline bool operator!=(const iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    BasicCSVMergeReader *reader_;
+    entry_t entry_;
+    std::size_t source_;
+  };
+
+  /**
+   * @brief BasicCSVMergeReader constructor.
+   * @param paths       - the files to be merged
+   * @param has_header  - whether the first line of each file is a header
+   * @param buffer_size - size of the read buffer per file in bytes
+   */
+  inline explicit BasicCSVMergeReader(const std::vector<std::string> &paths,
+                                      const bool has_header = true,
+                                      const std::size_t buffer_size = 1 << 20)
+      : heads_(paths.size()) {
+    readers_.reserve(paths.size());
+    heap_.reserve(paths.size());
+    for (std::size_t s = 0; s < paths.size(); ++s) {
+      readers_.emplace_back(new reader_t(paths[s], has_header, buffer_size));
+      if (!readers_[s]->isOpen()) {
+        std::cerr << "[CSVMergeReader]: Could not open path '" << paths[s]
+                  << "'!\n";
+      }
+      advance(s);
+    }
+  }
+  inline virtual ~BasicCSVMergeReader() = default;
+
+  /**
+   * @brief Number of files merged.
+   */
+  inline std::size_t sources() const { return readers_.size(); }
+
+  inline reader_t const &getReader(const std::size_t source) const {
+    return *readers_[source];
+  }
+
+  /**
+   * @brief Parse the row with the smallest key over all files.
+   * @param entry   - the row
+   * @param source  - the index of the file the row was read from
+   * @return false if all files are exhausted
+   */
+  inline bool next(entry_t &entry, std::size_t &source) {
+    if (heap_.empty()) {
+      return false;
+    }
+    std::pop_heap(heap_.begin(), heap_.end(), std::greater<head_t>());
+    source = heap_.back().second;
+    heap_.pop_back();
+    entry = std::move(heads_[source]);
+    advance(source);
+    return true;
+  }
+
+  inline bool next(entry_t &entry) {
+    std::size_t source;
+    return next(entry, source);
+  }
+
+  inline iterator begin() { return iterator(this); }
+
+  inline iterator end() { return iterator(); }
+
+ private:
+  /// the key of the next row of a file and the file's index, the index
+  /// breaks ties so that equal keys keep the order of the files
+  using head_t = std::pair<key_t, std::size_t>;
+
+  std::vector<typename reader_t::Ptr> readers_;
+  std::vector<entry_t> heads_;
+  std::vector<head_t> heap_;
+
+  /**
+   * @brief Read the next row of a file into the heap.
+   */
+  inline void advance(const std::size_t source) {
+    if (readers_[source]->next(heads_[source])) {
+      heap_.emplace_back(std::get<Key>(heads_[source]), source);
+      std::push_heap(heap_.begin(), heap_.end(), std::greater<head_t>());
+    }
+  }
+};
+
+/// merges files written by CSVLogger<Types...> by their time column
+template <typename... Types>
+using CSVMergeReader = BasicCSVMergeReader<0, std::int64_t, Types...>;
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_MERGE_READER_HPP
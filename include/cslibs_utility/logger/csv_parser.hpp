@@ -0,0 +1,261 @@
+#ifndef CSLIBS_UTILITY_CSV_PARSER_HPP
+#define CSLIBS_UTILITY_CSV_PARSER_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(CSLIBS_UTILITY_CSV_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <cslibs_utility/concurrency/thread_pool.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief Find the end of a field, which is either the delimiter, a newline
+ *        or the end of the buffer. Defining CSLIBS_UTILITY_CSV_SIMD enables
+ *        an SSE2 scan over 16 bytes at a time, which pays off for wide
+ *        fields.
+ * @param begin     - start of the field
+ * @param end       - end of the buffer
+ * @param delimiter - the column delimiter
+ * @return pointer to the character terminating the field
+ */
+inline const char *findFieldEnd(const char *begin, const char *end,
+                                const char delimiter) {
+#if defined(CSLIBS_UTILITY_CSV_SIMD) && defined(__SSE2__)
+  const __m128i d = _mm_set1_epi8(delimiter);
+  const __m128i n = _mm_set1_epi8('\n');
+  while (end - begin >= 16) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+    const int mask = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, d), _mm_cmpeq_epi8(chunk, n)));
+    if (mask != 0) {
+      return begin + __builtin_ctz(static_cast<unsigned int>(mask));
+    }
+    begin += 16;
+  }
+#endif
+  while (begin != end && *begin != delimiter && *begin != '\n') {
+    ++begin;
+  }
+  return begin;
+}
+
+/**
+ * @brief Find the end of the current line.
+ * @return pointer to the newline or the end of the buffer
+ */
+inline const char *findLineEnd(const char *begin, const char *end) {
+  const void *n = std::memchr(begin, '\n', static_cast<std::size_t>(end - begin));
+  return n ? static_cast<const char *>(n) : end;
+}
+
+/**
+ * @brief Split a buffer into about equally sized chunks, each ending right
+ *        after a newline or at the end of the buffer.
+ * @param begin   - start of the buffer
+ * @param end     - end of the buffer
+ * @param chunks  - the preferred number of chunks
+ * @return the chunk boundaries, empty chunks are omitted
+ */
+inline std::vector<std::pair<const char *, const char *>> splitChunks(
+    const char *begin, const char *end, const std::size_t chunks) {
+  std::vector<std::pair<const char *, const char *>> result;
+  const std::size_t chunk_size =
+      static_cast<std::size_t>(end - begin) / std::max<std::size_t>(chunks, 1) + 1;
+  while (begin != end) {
+    const char *chunk_end =
+        static_cast<std::size_t>(end - begin) <= chunk_size
+            ? end
+            : findLineEnd(begin + chunk_size, end);
+    if (chunk_end != end) ++chunk_end;
+    result.emplace_back(begin, chunk_end);
+    begin = chunk_end;
+  }
+  return result;
+}
+
+/**
+ * @brief Call parse(i) for each chunk i in parallel, on the workers of pool
+ *        if given, otherwise on threads spawned for the call. The calling
+ *        thread takes part in both cases.
+ * @param chunks  - the number of chunks
+ * @param parse   - called as parse(std::size_t i)
+ * @param pool    - the pool to run on, nullptr spawns threads
+ */
+template <typename Parse>
+inline void parseChunks(const std::size_t chunks, Parse &&parse,
+                        concurrency::thread_pool *pool) {
+  if (pool) {
+    pool->parallel_for(0, chunks, parse, 1);
+    return;
+  }
+  std::vector<std::thread> workers;
+  for (std::size_t i = 1; i < chunks; ++i) {
+    workers.emplace_back([&parse, i]() { parse(i); });
+  }
+  if (chunks > 0) {
+    parse(0);
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+}
+
+/**
+ * @brief Parse a single field in place. Arithmetic types are parsed with
+ *        std::from_chars and must span the whole trimmed field, strings take
+ *        the full field, any other type falls back to stream extraction.
+ * @param field - the field without delimiters
+ * @param t     - the target value
+ * @return whether the field could be parsed
+ */
+template <typename T>
+inline bool fromChars(std::string_view field, T &t) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    if (!field.empty() && field.back() == '\r') {
+      field.remove_suffix(1);
+    }
+    t.assign(field.data(), field.size());
+    return true;
+  } else if constexpr (std::is_arithmetic<T>::value) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '+')) {
+      field.remove_prefix(1);
+    }
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\r')) {
+      field.remove_suffix(1);
+    }
+    if constexpr (std::is_same<T, bool>::value) {
+      int value = 0;
+      const auto result =
+          std::from_chars(field.data(), field.data() + field.size(), value);
+      t = value != 0;
+      return result.ec == std::errc() &&
+             result.ptr == field.data() + field.size();
+    } else {
+      const auto result =
+          std::from_chars(field.data(), field.data() + field.size(), t);
+      return result.ec == std::errc() &&
+             result.ptr == field.data() + field.size();
+    }
+  } else {
+    std::stringstream ss{std::string(field)};
+    ss >> t;
+    return !ss.fail();
+  }
+}
+
+/**
+ * @brief The CSVParser class tokenizes rows in place and parses the columns
+ *        of Types... directly into caller provided storage. The column loop
+ *        is unrolled at compile time.
+ */
+template <typename... Types>
+class CSVParser {
+ public:
+  static constexpr std::size_t size = sizeof...(Types);
+  static constexpr char delimiter = ',';
+
+  /**
+   * @brief Parse one row and advance past its newline. Rows with too few
+   *        columns are rejected, surplus columns are ignored.
+   * @param pos     - the current position, set to the start of the next row
+   * @param end     - end of the buffer
+   * @param fields  - the target values
+   * @return whether the row was parsed completely
+   */
+  static inline bool parse(const char *&pos, const char *end,
+                           Types &... fields) {
+    return parse(pos, end, std::index_sequence_for<Types...>(), fields...);
+  }
+
+  /**
+   * @brief Skip the current row.
+   * @param pos - the current position, set to the start of the next row
+   * @param end - end of the buffer
+   */
+  static inline void skip(const char *&pos, const char *end) {
+    pos = findLineEnd(pos, end);
+    if (pos != end) ++pos;
+  }
+
+  /**
+   * @brief Read the current row as header and advance past it, missing
+   *        column names are left empty.
+   * @param pos     - the current position, set to the start of the next row
+   * @param end     - end of the buffer
+   * @param header  - the column names
+   */
+  static inline void header(const char *&pos, const char *end,
+                            std::array<std::string, size> &header) {
+    std::vector<std::string_view> tokens;
+    split(pos, end, tokens);
+    for (std::size_t i = 0; i < size; ++i) {
+      header[i] = i < tokens.size() ? std::string(tokens[i]) : std::string();
+    }
+  }
+
+  /**
+   * @brief Split the current row into string views and advance past it.
+   * @param pos     - the current position, set to the start of the next row
+   * @param end     - end of the buffer
+   * @param tokens  - the tokens of the row
+   */
+  static inline void split(const char *&pos, const char *end,
+                           std::vector<std::string_view> &tokens) {
+    tokens.clear();
+    const char *line_end = findLineEnd(pos, end);
+    const char *content_end =
+        (line_end != pos && *(line_end - 1) == '\r') ? line_end - 1 : line_end;
+    for (;;) {
+      const char *field_end = findFieldEnd(pos, content_end, delimiter);
+      tokens.emplace_back(pos, static_cast<std::size_t>(field_end - pos));
+      if (field_end == content_end) break;
+      pos = field_end + 1;
+    }
+    pos = line_end == end ? end : line_end + 1;
+  }
+
+ private:
+  template <std::size_t... I>
+  static inline bool parse(const char *&pos, const char *end,
+                           std::index_sequence<I...>, Types &... fields) {
+    bool ok = true;
+    ((ok = ok && parseField<I == size - 1>(pos, end, fields)), ...);
+    if (!ok || (pos != end && *pos != '\n')) {
+      skip(pos, end);
+      return ok;
+    }
+    if (pos != end) ++pos;
+    return true;
+  }
+
+  template <bool last, typename T>
+  static inline bool parseField(const char *&pos, const char *end, T &t) {
+    const char *field_end = findFieldEnd(pos, end, delimiter);
+    if (!last && (field_end == end || *field_end == '\n')) {
+      pos = field_end;
+      return false;
+    }
+    const bool ok =
+        fromChars(std::string_view(pos, static_cast<std::size_t>(field_end - pos)), t);
+    pos = (last || !ok) ? field_end : field_end + 1;
+    return ok;
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_PARSER_HPP
@@ -1,20 +1,39 @@
 #ifndef CSLIBS_UTILITY_CSV_READER_HPP
 #define CSLIBS_UTILITY_CSV_READER_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <sstream>
 #include <thread>
 #include <tuple>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_parser.hpp>
+#include <cslibs_utility/logger/mapped_file.hpp>
 
 namespace cslibs_utility {
 namespace logger {
+/**
+ * @brief How CSVReader reads its input.
+ *        Stream  - line by line through std::getline and string streams,
+ *                  string columns are read up to the first whitespace.
+ *        Mapped  - the file is memory mapped and tokenized in place, numbers
+ *                  are parsed with std::from_chars, string columns take the
+ *                  full field. Rows with too few columns are skipped.
+ *        Parallel - like Mapped, but the file is split at newline boundaries
+ *                  into chunks which are parsed concurrently and stitched
+ *                  together in order.
+ */
+enum class CSVReadMode { Stream, Mapped, Parallel };
+
 template <typename T>
 inline typename std::remove_reference<T>::type fromString(const std::string &str) {
   typename std::remove_reference<T>::type data;
@@ -40,9 +59,41 @@ class CSVReader {
   using entry_t = std::tuple<Types...>;
   using data_t = std::vector<entry_t>;
 
+  /**
+   * @brief CSVReader constructor, the file is read completely.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param mode        - how the file is read
+   * @param threads     - number of threads for CSVReadMode::Parallel, zero
+   *                      selects the hardware concurrency
+   */
   inline explicit CSVReader(const std::string &path,
-                            const bool has_header = false)
-      : in_{path} {read(has_header);}
+                            const bool has_header = false,
+                            const CSVReadMode mode = CSVReadMode::Stream,
+                            const std::size_t threads = 0) {
+    if (mode == CSVReadMode::Mapped) {
+      readMapped(path, has_header, 1);
+    } else if (mode == CSVReadMode::Parallel) {
+      readMapped(path, has_header,
+                 threads > 0 ? threads
+                             : std::max(1u, std::thread::hardware_concurrency()));
+    } else {
+      in_.open(path);
+      read(has_header);
+    }
+  }
+
+  /**
+   * @brief CSVReader constructor reading like CSVReadMode::Parallel on the
+   *        workers of a shared pool.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param pool        - the pool, the calling thread takes part
+   */
+  inline CSVReader(const std::string &path, const bool has_header,
+                   concurrency::thread_pool &pool) {
+    readMapped(path, has_header, pool.size() + 1, &pool);
+  }
   inline virtual ~CSVReader() = default;
 
   inline bool hasHeader() const { return header_.has_value(); }
@@ -56,6 +107,67 @@ class CSVReader {
   std::optional<header_t> header_;
   data_t data_;
 
+  void readMapped(const std::string &path, const bool has_header,
+                  const std::size_t threads,
+                  concurrency::thread_pool *pool = nullptr) {
+    using parser_t = CSVParser<Types...>;
+
+    MappedFile file(path);
+    if (!file.isOpen()) {
+      return;
+    }
+    const char *pos = file.begin();
+    const char *end = file.end();
+    if (has_header) {
+      if (pos != end) {
+        parser_t::header(pos, end, header_.emplace());
+      } else {
+        std::cerr << "[CSVReader]: Could not read header." << std::endl;
+      }
+    }
+
+    /// small files are not worth spawning threads for
+    constexpr std::size_t min_chunk_size = 1 << 20;
+    const std::size_t chunks = std::min(
+        threads, static_cast<std::size_t>(end - pos) / min_chunk_size + 1);
+    if (chunks <= 1) {
+      parseRange(pos, end, data_);
+      return;
+    }
+
+    const auto ranges = splitChunks(pos, end, chunks);
+    std::vector<data_t> chunk_data(ranges.size());
+    parseChunks(ranges.size(), [&ranges, &chunk_data](const std::size_t i) {
+      parseRange(ranges[i].first, ranges[i].second, chunk_data[i]);
+    }, pool);
+
+    std::size_t rows = 0;
+    for (const auto &c : chunk_data) {
+      rows += c.size();
+    }
+    data_ = std::move(chunk_data[0]);
+    data_.reserve(rows);
+    for (std::size_t i = 1; i < chunk_data.size(); ++i) {
+      data_.insert(data_.end(), std::make_move_iterator(chunk_data[i].begin()),
+                   std::make_move_iterator(chunk_data[i].end()));
+    }
+  }
+
+  static void parseRange(const char *pos, const char *end, data_t &data) {
+    using parser_t = CSVParser<Types...>;
+    while (pos != end) {
+      entry_t &entry = data.emplace_back();
+      const bool parsed = std::apply(
+          [&pos, end](auto &... fields) {
+            return parser_t::parse(pos, end, fields...);
+          },
+          entry);
+      if (!parsed) {
+        data.pop_back();
+      }
+    }
+  }
+
   void read(const bool has_header) {
     if (in_.is_open()) {
       std::string line;
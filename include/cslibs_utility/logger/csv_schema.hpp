@@ -0,0 +1,121 @@
+#ifndef CSLIBS_UTILITY_CSV_SCHEMA_HPP
+#define CSLIBS_UTILITY_CSV_SCHEMA_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief A column of a compile-time CSV schema, which binds a column name
+ *        to a member of the row type.
+ */
+template <typename Struct, typename T>
+struct CSVColumn {
+  using struct_t = Struct;
+  using type = T;
+
+  const char *name;
+  T Struct::*member;
+};
+
+template <typename Struct, typename T>
+constexpr CSVColumn<Struct, T> makeCSVColumn(const char *name,
+                                             T Struct::*member) {
+  return CSVColumn<Struct, T>{name, member};
+}
+
+/**
+ * @brief The schema of a row type declared by CSLIBS_CSV_SCHEMA, a tuple of
+ *        CSVColumn. It is found by argument dependent lookup, thus the macro
+ *        has to be used in the namespace of the row type.
+ */
+template <typename Struct>
+constexpr auto csvSchema() {
+  return cslibsCSVSchema(static_cast<const Struct *>(nullptr));
+}
+
+template <typename Struct>
+using csv_schema_t = decltype(csvSchema<Struct>());
+
+template <typename Struct>
+constexpr std::size_t csv_schema_size =
+    std::tuple_size<csv_schema_t<Struct>>::value;
+
+template <typename Struct, std::size_t I>
+using csv_column_t =
+    typename std::tuple_element<I, csv_schema_t<Struct>>::type::type;
+
+/**
+ * @brief Index of the schema column called name.
+ * @return the column index, csv_schema_size<Struct> if there is none
+ */
+template <typename Struct>
+constexpr std::size_t csvColumnIndex(const std::string_view name) {
+  constexpr auto schema = csvSchema<Struct>();
+  std::size_t index = csv_schema_size<Struct>;
+  std::size_t i = 0;
+  std::apply(
+      [&](const auto &... columns) {
+        ((index = (index == csv_schema_size<Struct> &&
+                   name == std::string_view(columns.name))
+                      ? i
+                      : index,
+          ++i),
+         ...);
+      },
+      schema);
+  return index;
+}
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#define CSLIBS_CSV_EXPAND(x) x
+#define CSLIBS_CSV_COLUMN(Type, member) \
+  ::cslibs_utility::logger::makeCSVColumn(#member, &Type::member)
+
+#define CSLIBS_CSV_FE_1(F, T, a) F(T, a)
+#define CSLIBS_CSV_FE_2(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_1(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_3(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_2(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_4(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_3(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_5(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_4(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_6(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_5(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_7(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_6(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_8(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_7(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_9(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_8(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_10(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_9(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_11(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_10(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_12(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_11(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_13(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_12(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_14(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_13(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_15(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_14(F, T, __VA_ARGS__))
+#define CSLIBS_CSV_FE_16(F, T, a, ...) F(T, a), CSLIBS_CSV_EXPAND(CSLIBS_CSV_FE_15(F, T, __VA_ARGS__))
+
+#define CSLIBS_CSV_GET_FE(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, \
+                          _13, _14, _15, _16, NAME, ...)                     \
+  NAME
+#define CSLIBS_CSV_FOR_EACH(F, T, ...)                                        \
+  CSLIBS_CSV_EXPAND(CSLIBS_CSV_GET_FE(                                        \
+      __VA_ARGS__, CSLIBS_CSV_FE_16, CSLIBS_CSV_FE_15, CSLIBS_CSV_FE_14,      \
+      CSLIBS_CSV_FE_13, CSLIBS_CSV_FE_12, CSLIBS_CSV_FE_11, CSLIBS_CSV_FE_10, \
+      CSLIBS_CSV_FE_9, CSLIBS_CSV_FE_8, CSLIBS_CSV_FE_7, CSLIBS_CSV_FE_6,     \
+      CSLIBS_CSV_FE_5, CSLIBS_CSV_FE_4, CSLIBS_CSV_FE_3, CSLIBS_CSV_FE_2,     \
+      CSLIBS_CSV_FE_1)(F, T, __VA_ARGS__))
+
+/**
+ * @brief Declare the CSV schema of a row type, the columns are named after
+ *        the members and appear in the given order. Up to 16 members are
+ *        supported, the macro has to be used in the namespace of the type.
+ *
+ *        struct Pose { double time; double x; double y; };
+ *        CSLIBS_CSV_SCHEMA(Pose, time, x, y)
+ */
+#define CSLIBS_CSV_SCHEMA(Type, ...)                              \
+  inline constexpr auto cslibsCSVSchema(const Type *) {           \
+    return std::make_tuple(                                       \
+        CSLIBS_CSV_FOR_EACH(CSLIBS_CSV_COLUMN, Type, __VA_ARGS__)); \
+  }
+
+#endif  // CSLIBS_UTILITY_CSV_SCHEMA_HPP
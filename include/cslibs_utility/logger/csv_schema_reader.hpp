@@ -0,0 +1,251 @@
+#ifndef CSLIBS_UTILITY_CSV_SCHEMA_READER_HPP
+#define CSLIBS_UTILITY_CSV_SCHEMA_READER_HPP
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_parser.hpp>
+#include <cslibs_utility/logger/csv_schema.hpp>
+#include <cslibs_utility/logger/mapped_file.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The CSVSchemaReader class reads a CSV file into rows of a type
+ *        declared with CSLIBS_CSV_SCHEMA. The columns of the file are matched
+ *        to the schema by their header names once, so files with reordered or
+ *        additional columns can be read, projecting onto the schema. Columns
+ *        which are not part of the schema are skipped without being parsed,
+ *        schema columns missing in the file keep their value initialized
+ *        state. If the file starts with the schema columns in order, rows are
+ *        parsed like CSVReadMode::Mapped does, otherwise each field is
+ *        dispatched through a per-column table built from the header.
+ */
+template <typename Struct>
+class CSVSchemaReader {
+ public:
+  using Ptr = std::unique_ptr<CSVSchemaReader<Struct>>;
+
+  static constexpr std::size_t size = csv_schema_size<Struct>;
+  using data_t = std::vector<Struct>;
+
+  /**
+   * @brief CSVSchemaReader constructor, the file is read completely.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header, without one the
+   *                      columns are expected in schema order
+   * @param threads     - number of parsing threads, zero selects the hardware
+   *                      concurrency
+   */
+  inline explicit CSVSchemaReader(const std::string &path,
+                                  const bool has_header = true,
+                                  const std::size_t threads = 1) {
+    read(path, has_header,
+         threads > 0 ? threads
+                     : std::max(1u, std::thread::hardware_concurrency()));
+  }
+
+  /**
+   * @brief CSVSchemaReader constructor parsing on the workers of a shared
+   *        pool.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param pool        - the pool, the calling thread takes part
+   */
+  inline CSVSchemaReader(const std::string &path, const bool has_header,
+                         concurrency::thread_pool &pool) {
+    read(path, has_header, pool.size() + 1, &pool);
+  }
+  inline virtual ~CSVSchemaReader() = default;
+
+  /**
+   * @brief The column names of the file, the schema names if it has no
+   *        header.
+   */
+  inline std::vector<std::string> const &getHeader() const { return header_; }
+
+  inline data_t const &getData() const { return data_; }
+
+  /**
+   * @brief Whether schema column I was found in the file.
+   */
+  inline bool hasColumn(const std::size_t i) const { return found_[i]; }
+
+ private:
+  using field_parser_t = bool (*)(std::string_view, Struct &);
+  using parser_t = CSVParser<>;
+
+  static constexpr auto schema_ = csvSchema<Struct>();
+
+  /// the schema column parser for each column of the file, nullptr skips
+  struct layout_t {
+    std::vector<field_parser_t> fields;
+    bool in_order = true;
+  };
+
+  std::vector<std::string> header_;
+  std::array<bool, size> found_{};
+  data_t data_;
+
+  void read(const std::string &path, const bool has_header,
+            const std::size_t threads,
+            concurrency::thread_pool *pool = nullptr) {
+    MappedFile file(path);
+    if (!file.isOpen()) {
+      return;
+    }
+    const char *pos = file.begin();
+    const char *end = file.end();
+
+    layout_t layout;
+    if (has_header) {
+      if (pos == end) {
+        std::cerr << "[CSVSchemaReader]: Could not read header." << std::endl;
+        return;
+      }
+      std::vector<std::string_view> tokens;
+      parser_t::split(pos, end, tokens);
+      layout = buildLayout(tokens);
+    } else {
+      layout = buildLayout();
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+      if (!found_[i]) {
+        std::cerr << "[CSVSchemaReader]: Column '" << columnName(i)
+                  << "' is missing." << std::endl;
+      }
+    }
+
+    /// small files are not worth spawning threads for
+    constexpr std::size_t min_chunk_size = 1 << 20;
+    const std::size_t chunks = std::min(
+        threads, static_cast<std::size_t>(end - pos) / min_chunk_size + 1);
+    if (chunks <= 1) {
+      parseRange(pos, end, layout, data_);
+      return;
+    }
+
+    const auto ranges = splitChunks(pos, end, chunks);
+    std::vector<data_t> chunk_data(ranges.size());
+    parseChunks(ranges.size(),
+                [&ranges, &layout, &chunk_data](const std::size_t i) {
+                  parseRange(ranges[i].first, ranges[i].second, layout,
+                             chunk_data[i]);
+                }, pool);
+
+    std::size_t rows = 0;
+    for (const auto &c : chunk_data) {
+      rows += c.size();
+    }
+    data_ = std::move(chunk_data[0]);
+    data_.reserve(rows);
+    for (std::size_t i = 1; i < chunk_data.size(); ++i) {
+      data_.insert(data_.end(), std::make_move_iterator(chunk_data[i].begin()),
+                   std::make_move_iterator(chunk_data[i].end()));
+    }
+  }
+
+  layout_t buildLayout(const std::vector<std::string_view> &tokens) {
+    static constexpr std::array<field_parser_t, size> parsers =
+        fieldParsers(std::make_index_sequence<size>());
+    layout_t layout;
+    for (std::size_t j = 0; j < tokens.size(); ++j) {
+      header_.emplace_back(tokens[j]);
+      const std::size_t i = csvColumnIndex<Struct>(tokens[j]);
+      if (i < size && !found_[i]) {
+        found_[i] = true;
+        layout.fields.push_back(parsers[i]);
+        layout.in_order = layout.in_order && i == j;
+      } else {
+        layout.fields.push_back(nullptr);
+        layout.in_order = layout.in_order && j >= size;
+      }
+    }
+    layout.in_order = layout.in_order && tokens.size() >= size;
+    return layout;
+  }
+
+  layout_t buildLayout() {
+    layout_t layout;
+    for (std::size_t i = 0; i < size; ++i) {
+      header_.emplace_back(columnName(i));
+      found_[i] = true;
+    }
+    return layout;
+  }
+
+  static void parseRange(const char *pos, const char *end,
+                         const layout_t &layout, data_t &data) {
+    if (layout.in_order) {
+      parseInOrder(pos, end, data, std::make_index_sequence<size>());
+      return;
+    }
+
+    /// the row is rejected if a schema column is missing
+    std::size_t required = 0;
+    for (std::size_t j = 0; j < layout.fields.size(); ++j) {
+      if (layout.fields[j]) required = j + 1;
+    }
+    std::vector<std::string_view> tokens;
+    while (pos != end) {
+      parser_t::split(pos, end, tokens);
+      if (tokens.size() < required) {
+        continue;
+      }
+      Struct &s = data.emplace_back();
+      bool ok = true;
+      for (std::size_t j = 0; j < required && ok; ++j) {
+        if (layout.fields[j]) ok = layout.fields[j](tokens[j], s);
+      }
+      if (!ok) {
+        data.pop_back();
+      }
+    }
+  }
+
+  template <std::size_t... I>
+  static void parseInOrder(const char *pos, const char *end, data_t &data,
+                           std::index_sequence<I...>) {
+    using row_parser_t = CSVParser<csv_column_t<Struct, I>...>;
+    while (pos != end) {
+      Struct &s = data.emplace_back();
+      if (!row_parser_t::parse(pos, end, s.*(std::get<I>(schema_).member)...)) {
+        data.pop_back();
+      }
+    }
+  }
+
+  template <std::size_t I>
+  static bool parseField(std::string_view field, Struct &s) {
+    return fromChars(field, s.*(std::get<I>(schema_).member));
+  }
+
+  template <std::size_t... I>
+  static constexpr std::array<field_parser_t, size> fieldParsers(
+      std::index_sequence<I...>) {
+    return {{&parseField<I>...}};
+  }
+
+  static std::string columnName(const std::size_t i) {
+    std::string name;
+    std::size_t c = 0;
+    std::apply(
+        [&](const auto &... columns) {
+          ((c++ == i ? void(name = columns.name) : void()), ...);
+        },
+        schema_);
+    return name;
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_SCHEMA_READER_HPP
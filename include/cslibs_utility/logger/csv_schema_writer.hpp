@@ -0,0 +1,100 @@
+#ifndef CSLIBS_UTILITY_CSV_SCHEMA_WRITER_HPP
+#define CSLIBS_UTILITY_CSV_SCHEMA_WRITER_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <cslibs_utility/logger/async_writer.hpp>
+#include <cslibs_utility/logger/csv_formatter.hpp>
+#include <cslibs_utility/logger/csv_schema.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The CSVSchemaWriter class writes rows of a type declared with
+ *        CSLIBS_CSV_SCHEMA. The header is generated from the schema, the
+ *        members are formatted in schema order by an unrolled loop.
+ */
+template <typename Struct>
+class CSVSchemaWriter {
+ public:
+  using Ptr = std::shared_ptr<CSVSchemaWriter<Struct>>;
+
+  static constexpr std::size_t size = csv_schema_size<Struct>;
+  static constexpr char delimiter = ',';
+  using options_t = AsyncWriter::Options;
+
+  inline explicit CSVSchemaWriter(const std::string &path,
+                                  const options_t &options = options_t())
+      : out_(path, header(), options) {}
+
+  virtual ~CSVSchemaWriter() = default;
+
+  inline void write(const Struct &s) { out_.append(format(s)); }
+
+  /**
+   * @brief Write a row without ever blocking the caller, the row is dropped
+   *        instead.
+   * @param s - the row
+   * @return whether the row was accepted
+   */
+  inline bool tryWrite(const Struct &s) { return out_.tryAppend(format(s)); }
+
+  inline std::string const &path() const { return out_.path(); }
+
+  /**
+   * @brief Number of rows which were dropped instead of written.
+   */
+  inline std::size_t dropped() const { return out_.dropped(); }
+
+  /**
+   * @brief The header line including the trailing newline.
+   */
+  static inline std::string header() {
+    std::string line;
+    std::apply(
+        [&line](const auto &... columns) {
+          ((line.empty() ? void() : line.push_back(delimiter),
+            line.append(columns.name)),
+           ...);
+        },
+        schema_);
+    line.push_back('\n');
+    return line;
+  }
+
+  /**
+   * @brief Append a row including the trailing newline to the buffer.
+   * @param buffer  - the buffer to append to
+   * @param s       - the row
+   */
+  static inline void formatRow(std::string &buffer, const Struct &s) {
+    formatRow(buffer, s, std::make_index_sequence<size>());
+  }
+
+ private:
+  static constexpr auto schema_ = csvSchema<Struct>();
+
+  AsyncWriter out_;
+
+  static inline std::string const &format(const Struct &s) {
+    thread_local std::string row;
+    row.clear();
+    formatRow(row, s);
+    return row;
+  }
+
+  template <std::size_t... I>
+  static inline void formatRow(std::string &buffer, const Struct &s,
+                               std::index_sequence<I...>) {
+    ((I > 0 ? buffer.push_back(delimiter) : void(),
+      appendField(buffer, s.*(std::get<I>(schema_).member))),
+     ...);
+    buffer.push_back('\n');
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_SCHEMA_WRITER_HPP
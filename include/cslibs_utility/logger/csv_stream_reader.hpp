@@ -0,0 +1,194 @@
+#ifndef CSLIBS_UTILITY_CSV_STREAM_READER_HPP
+#define CSLIBS_UTILITY_CSV_STREAM_READER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_parser.hpp>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The CSVStreamReader class parses a CSV file incrementally. Only a
+ *        fixed size read buffer is kept in memory, which grows only if a
+ *        single line exceeds it, thus files larger than the main memory can
+ *        be processed and the first rows are available immediately.
+ *        Rows are parsed like CSVReadMode::Mapped does.
+ */
+template <typename... Types>
+class CSVStreamReader {
+ public:
+  using Ptr = std::unique_ptr<CSVStreamReader<Types...>>;
+
+  static constexpr std::size_t size = sizeof...(Types);
+  using header_t = std::array<std::string, size>;
+  using entry_t = std::tuple<Types...>;
+  using data_t = std::vector<entry_t>;
+  using parser_t = CSVParser<Types...>;
+
+  /**
+   * @brief The iterator class is an input iterator over the remaining rows.
+   *        Incrementing it consumes a row of the reader.
+   */
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = entry_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const entry_t *;
+    using reference = const entry_t &;
+
+    iterator() : reader_(nullptr) {}
+
+    explicit iterator(CSVStreamReader *reader) : reader_(reader) { ++(*this); }
+
+    inline iterator &operator++() {
+      if (reader_ && !reader_->next(entry_)) {
+        reader_ = nullptr;
+      }
+      return *this;
+    }
+
+    inline reference operator*() const { return entry_; }
+
+    inline pointer operator->() const { return &entry_; }
+
+    inline bool operator==(const iterator &other) const {
+      return reader_ == other.reader_;
+    }
+
+    inline bool operator!=(const iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    CSVStreamReader *reader_;
+    entry_t entry_;
+  };
+
+  /**
+   * @brief CSVStreamReader constructor.
+   * @param path        - the file to be read
+   * @param has_header  - whether the first line is a header
+   * @param buffer_size - size of the read buffer in bytes
+   */
+  inline explicit CSVStreamReader(const std::string &path,
+                                  const bool has_header = false,
+                                  const std::size_t buffer_size = 1 << 20)
+      : in_{path, std::ios::binary},
+        buffer_(std::max<std::size_t>(buffer_size, 64)),
+        pos_(0),
+        end_(0),
+        eof_(!in_.is_open()) {
+    if (has_header) {
+      if (fill()) {
+        const char *pos = buffer_.data() + pos_;
+        parser_t::header(pos, buffer_.data() + end_, header_.emplace());
+        pos_ = static_cast<std::size_t>(pos - buffer_.data());
+      } else {
+        std::cerr << "[CSVStreamReader]: Could not read header." << std::endl;
+      }
+    }
+  }
+  inline virtual ~CSVStreamReader() = default;
+
+  inline bool isOpen() const { return in_.is_open(); }
+
+  inline bool hasHeader() const { return header_.has_value(); }
+
+  inline header_t const &getHeader() const { return header_.value(); }
+
+  /**
+   * @brief Parse the next valid row, malformed rows are skipped.
+   * @param entry - the parsed row
+   * @return false if there are no more rows
+   */
+  inline bool next(entry_t &entry) {
+    while (fill()) {
+      const char *begin = buffer_.data();
+      const char *pos = begin + pos_;
+      const bool parsed = std::apply(
+          [&pos, begin, this](auto &... fields) {
+            return parser_t::parse(pos, begin + end_, fields...);
+          },
+          entry);
+      pos_ = static_cast<std::size_t>(pos - begin);
+      if (parsed) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Parse up to n rows and append them to batch.
+   * @param n     - the maximum number of rows
+   * @param batch - the rows are appended here
+   * @return the number of rows appended, zero at the end of the file
+   */
+  inline std::size_t nextBatch(const std::size_t n, data_t &batch) {
+    std::size_t count = 0;
+    while (count < n) {
+      entry_t &entry = batch.emplace_back();
+      if (!next(entry)) {
+        batch.pop_back();
+        break;
+      }
+      ++count;
+    }
+    return count;
+  }
+
+  inline iterator begin() { return iterator(this); }
+
+  inline iterator end() { return iterator(); }
+
+ private:
+  std::ifstream in_;
+  std::optional<header_t> header_;
+  std::vector<char> buffer_;
+  std::size_t pos_;
+  std::size_t end_;
+  bool eof_;
+
+  /**
+   * @brief Make sure that a complete line is buffered, compact and refill the
+   *        buffer otherwise.
+   * @return false if no more data is available
+   */
+  inline bool fill() {
+    for (;;) {
+      if (pos_ != end_ &&
+          std::memchr(buffer_.data() + pos_, '\n', end_ - pos_) != nullptr) {
+        return true;
+      }
+      if (eof_) {
+        return pos_ != end_;
+      }
+
+      const std::size_t remaining = end_ - pos_;
+      if (remaining == buffer_.size()) {
+        buffer_.resize(2 * buffer_.size());
+      }
+      std::memmove(buffer_.data(), buffer_.data() + pos_, remaining);
+      in_.read(buffer_.data() + remaining,
+               static_cast<std::streamsize>(buffer_.size() - remaining));
+      const std::size_t read = static_cast<std::size_t>(in_.gcount());
+      eof_ = !in_;
+      pos_ = 0;
+      end_ = remaining + read;
+    }
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_CSV_STREAM_READER_HPP
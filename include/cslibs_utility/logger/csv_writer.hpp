@@ -1,28 +1,15 @@
 #ifndef CSLIBS_UTILITY_CSV_WRITER_HPP
 #define CSLIBS_UTILITY_CSV_WRITER_HPP
 
-#include <atomic>
-#include <chrono>
-#include <condition_variable>
-#include <fstream>
-#include <iostream>
-#include <mutex>
-#include <queue>
-#include <sstream>
-#include <thread>
+#include <array>
+#include <memory>
+#include <string>
+
+#include <cslibs_utility/logger/async_writer.hpp>
+#include <cslibs_utility/logger/csv_formatter.hpp>
 
 namespace cslibs_utility {
 namespace logger {
-template <typename T>
-inline std::string toString(const T &t) {
-  return std::to_string(t);
-}
-
-template <>
-inline std::string toString<std::string>(const std::string &str) {
-  return str;
-}
-
 template <typename... Types>
 class CSVWriter {
  public:
@@ -30,97 +17,67 @@ class CSVWriter {
 
   static constexpr std::size_t size = sizeof...(Types);
   using header_t = std::array<std::string, size>;
+  using formatter_t = CSVFormatter<Types...>;
+  using options_t = AsyncWriter::Options;
 
-  inline void write(const Types... ts) {
-    std::string string_built = buildString(ts...);
-    std::unique_lock<std::mutex> q_lock(q_mutex_);
-    q_.push(string_built);
-    notify_log_.notify_one();
+  inline void write(const Types &... ts) {
+    out_.append(format(ts...));
   }
 
-  inline CSVWriter(const header_t &header, const std::string &path)
-      : header_(header), has_header_(true), path_(path), stop_(false) {
-    worker_thread_ = std::thread([this] { loop(); });
+  /**
+   * @brief Write a row without ever blocking the caller, the row is dropped
+   *        instead. Meant for real-time threads, best combined with the ring
+   *        buffer backend, see options_t::ring_capacity.
+   * @param ts  - the column values
+   * @return whether the row was accepted
+   */
+  inline bool tryWrite(const Types &... ts) {
+    return out_.tryAppend(format(ts...));
   }
 
-  inline CSVWriter(const std::string &path)
-      : has_header_(false), path_(path), stop_(false) {
-    worker_thread_ = std::thread([this] { loop(); });
-  }
+  inline CSVWriter(const header_t &header, const std::string &path,
+                   const options_t &options = options_t())
+      : out_(path, buildHeader(header), options) {}
 
-  virtual ~CSVWriter() {
-    if (worker_thread_.joinable()) {
-      stop_ = true;
-      notify_log_.notify_one();
-      worker_thread_.join();
-    }
-  }
+  inline CSVWriter(const std::string &path,
+                   const options_t &options = options_t())
+      : out_(path, "", options) {}
+
+  virtual ~CSVWriter() = default;
 
   inline std::string const & path() const
   {
-    return path_;
+    return out_.path();
   }
 
- private:
-  std::ofstream out_;
-  header_t header_;
-  bool has_header_;
-  std::string path_;
-  long start_time_;
-
-  std::thread worker_thread_;
-  std::mutex q_mutex_;
-  std::queue<std::string> q_;
-  std::mutex notify_mutex_;
-  std::condition_variable notify_log_;
-
-  std::atomic_bool stop_;
-
-  void loop() {
-    out_.open(path_);
-    if (!out_.is_open()) {
-      std::cerr << "[CSVWriter]: Could not open path '" << path_ << "'!\n";
-      return;
-    }
-
-    if (has_header_) {
-      for (std::size_t i = 0; i < size - 1; ++i) {
-        out_ << header_[i] << ",";
-      }
-      out_ << header_[size - 1];
-      out_ << "\n";
-    }
-
-    auto dumpQ = [this]() {
-      while (!q_.empty()) {
-        std::unique_lock<std::mutex> q_lock(q_mutex_);
-        auto f = q_.front();
-        q_.pop();
-        q_lock.unlock();
-
-        out_ << f << "\n";
-      }
-    };
-
-    std::unique_lock<std::mutex> notify_lock(notify_mutex_);
-    while (!stop_) {
-      notify_log_.wait(notify_lock);
-      dumpQ();
-    }
-    dumpQ();
-
-    out_.flush();
-    if (out_.is_open()) out_.close();
+  /**
+   * @brief Number of rows which were dropped instead of written.
+   */
+  inline std::size_t dropped() const
+  {
+    return out_.dropped();
   }
 
-  template <typename WT, typename... WTypes>
-  inline std::string buildString(const WT &t, WTypes... ts) const {
-    return toString(t) + "," + buildString(ts...);
+ private:
+  AsyncWriter out_;
+
+  static inline std::string const &format(const Types &... ts) {
+    /// formatting happens into a per-thread buffer outside the lock, the
+    /// buffer keeps its capacity, thus steady state writes do not allocate
+    thread_local std::string row;
+    row.clear();
+    formatter_t::formatRow(row, ts...);
+    return row;
   }
 
-  template <typename T>
-  inline std::string buildString(const T &t) const {
-    return toString(t);
+  static inline std::string buildHeader(const header_t &header) {
+    std::string line;
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i > 0) line.push_back(formatter_t::delimiter);
+      line.append(header[i]);
+    }
+    line.push_back('\n');
+    return line;
   }
 };
 }  // namespace logger
@@ -0,0 +1,71 @@
+#ifndef CSLIBS_UTILITY_MAPPED_FILE_HPP
+#define CSLIBS_UTILITY_MAPPED_FILE_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief The MappedFile class maps a file read-only into memory for the
+ *        lifetime of the object.
+ */
+class MappedFile {
+ public:
+  inline explicit MappedFile(const std::string &path)
+      : data_(nullptr), size_(0), open_(false) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) == 0) {
+      size_ = static_cast<std::size_t>(st.st_size);
+      if (size_ == 0) {
+        open_ = true;
+      } else {
+        void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          ::madvise(data, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<const char *>(data);
+          open_ = true;
+        } else {
+          size_ = 0;
+        }
+      }
+    }
+    ::close(fd);
+  }
+
+  inline virtual ~MappedFile() {
+    if (data_) {
+      ::munmap(const_cast<char *>(data_), size_);
+    }
+  }
+
+  MappedFile(const MappedFile &other) = delete;
+  MappedFile &operator=(const MappedFile &other) = delete;
+
+  inline bool isOpen() const { return open_; }
+
+  inline const char *data() const { return data_; }
+
+  inline const char *begin() const { return data_; }
+
+  inline const char *end() const { return data_ + size_; }
+
+  inline std::size_t size() const { return size_; }
+
+ private:
+  const char *data_;
+  std::size_t size_;
+  bool open_;
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_MAPPED_FILE_HPP
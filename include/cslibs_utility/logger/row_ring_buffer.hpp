@@ -0,0 +1,216 @@
+#ifndef CSLIBS_UTILITY_ROW_RING_BUFFER_HPP
+#define CSLIBS_UTILITY_ROW_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief What happens to a row which does not fit into a full ring buffer.
+ */
+enum class OverflowPolicy {
+  DropNewest,  /// reject the new row
+  DropOldest,  /// evict the oldest pending row in favour of the new one
+  Block        /// yield until the consumer made room or the ring was closed,
+               /// not real-time safe
+};
+
+/**
+ * @brief The RowRingBuffer class is a bounded, lock-free ring of fixed size
+ *        byte slots. Any number of producers may push rows, rows are drained
+ *        by a single consumer. Slot sequence numbers follow the bounded queue
+ *        design of D. Vyukov; since the read position is claimed by
+ *        compare-and-swap as well, producers may evict the oldest row when the
+ *        ring is full. Neither push nor drain allocate or take a lock.
+ */
+class RowRingBuffer {
+ public:
+  /**
+   * @brief RowRingBuffer constructor.
+   * @param capacity  - number of slots, rounded up to the next power of two
+   * @param slot_size - maximum size of a single row in bytes
+   * @param policy    - overflow policy applied by push
+   */
+  inline RowRingBuffer(const std::size_t capacity, const std::size_t slot_size,
+                       const OverflowPolicy policy = OverflowPolicy::DropNewest)
+      : capacity_(roundUp(capacity)),
+        mask_(capacity_ - 1),
+        slot_size_(slot_size),
+        policy_(policy),
+        sequence_(new std::atomic<std::size_t>[capacity_]),
+        length_(new std::size_t[capacity_]),
+        data_(capacity_ * slot_size_),
+        enqueue_pos_(0),
+        dequeue_pos_(0),
+        dropped_(0),
+        closed_(false) {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      sequence_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  RowRingBuffer(const RowRingBuffer &other) = delete;
+  RowRingBuffer &operator=(const RowRingBuffer &other) = delete;
+
+  /**
+   * @brief Push a row according to the overflow policy. Rows exceeding the
+   *        slot size are always dropped.
+   * @param data  - the row data
+   * @param size  - the row size in bytes
+   * @return whether the row was accepted
+   */
+  inline bool push(const char *data, const std::size_t size) {
+    if (size > slot_size_) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    while (!tryPush(data, size)) {
+      switch (policy_) {
+        case OverflowPolicy::DropNewest:
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          return false;
+        case OverflowPolicy::DropOldest:
+          if (drain([](const char *, std::size_t) {}, 1) > 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+          }
+          break;
+        case OverflowPolicy::Block:
+          if (closed_.load(std::memory_order_acquire)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+          }
+          std::this_thread::yield();
+          break;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Try to push a row once, without applying the overflow policy.
+   * @param data  - the row data
+   * @param size  - the row size in bytes
+   * @return false if the ring is full or the row exceeds the slot size
+   */
+  inline bool tryPush(const char *data, const std::size_t size) {
+    if (size > slot_size_) {
+      return false;
+    }
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    std::size_t cell;
+    for (;;) {
+      cell = pos & mask_;
+      const std::size_t seq = sequence_[cell].load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                                  static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    std::memcpy(&data_[cell * slot_size_], data, size);
+    length_[cell] = size;
+    sequence_[cell].store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Drain pending rows and hand them to the consumer callback.
+   * @param consume - callable with signature void(const char*, std::size_t)
+   * @param max     - maximum number of rows to be drained
+   * @return the number of rows drained
+   */
+  template <typename Consumer>
+  inline std::size_t drain(Consumer &&consume,
+                           const std::size_t max = ~std::size_t(0)) {
+    std::size_t count = 0;
+    while (count < max) {
+      std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+      std::size_t cell;
+      for (;;) {
+        cell = pos & mask_;
+        const std::size_t seq = sequence_[cell].load(std::memory_order_acquire);
+        const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                                    static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+          if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (diff < 0) {
+          return count;
+        } else {
+          pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+      }
+      consume(&data_[cell * slot_size_], length_[cell]);
+      sequence_[cell].store(pos + capacity_, std::memory_order_release);
+      ++count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Signal that the ring will not be drained anymore, e.g. because
+   *        the consumer failed. Blocked and further blocking pushes drop
+   *        their rows instead of waiting for room forever.
+   */
+  inline void close() { closed_.store(true, std::memory_order_release); }
+
+  inline bool isClosed() const {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Number of rows dropped due to overflow or oversize.
+   */
+  inline std::size_t dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+  inline std::size_t capacity() const { return capacity_; }
+
+  inline std::size_t slotSize() const { return slot_size_; }
+
+  inline OverflowPolicy policy() const { return policy_; }
+
+ private:
+  static constexpr std::size_t cache_line_size = 64;
+
+  const std::size_t capacity_;
+  const std::size_t mask_;
+  const std::size_t slot_size_;
+  const OverflowPolicy policy_;
+
+  std::unique_ptr<std::atomic<std::size_t>[]> sequence_;
+  std::unique_ptr<std::size_t[]> length_;
+  std::vector<char> data_;
+
+  alignas(cache_line_size) std::atomic<std::size_t> enqueue_pos_;
+  alignas(cache_line_size) std::atomic<std::size_t> dequeue_pos_;
+  alignas(cache_line_size) std::atomic<std::size_t> dropped_;
+  std::atomic_bool closed_;
+
+  static inline std::size_t roundUp(const std::size_t capacity) {
+    std::size_t c = 2;
+    while (c < capacity) {
+      c <<= 1;
+    }
+    return c;
+  }
+};
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_ROW_RING_BUFFER_HPP
@@ -0,0 +1,243 @@
+#ifndef CSLIBS_UTILITY_SEGMENT_SINK_HPP
+#define CSLIBS_UTILITY_SEGMENT_SINK_HPP
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef CSLIBS_UTILITY_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CSLIBS_UTILITY_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+namespace cslibs_utility {
+namespace logger {
+/**
+ * @brief Streaming compression of the output segments. Gzip requires
+ *        CSLIBS_UTILITY_WITH_ZLIB, Zstd requires CSLIBS_UTILITY_WITH_ZSTD,
+ *        see the cmake options of the same name.
+ */
+enum class Compression { None, Gzip, Zstd };
+
+/**
+ * @brief Whether the compression was enabled at compile time.
+ */
+inline bool compressionAvailable(const Compression compression) {
+  switch (compression) {
+    case Compression::None:
+      return true;
+    case Compression::Gzip:
+#ifdef CSLIBS_UTILITY_WITH_ZLIB
+      return true;
+#else
+      return false;
+#endif
+    case Compression::Zstd:
+#ifdef CSLIBS_UTILITY_WITH_ZSTD
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+/**
+ * @brief The file name suffix of the compression, e.g. ".gz".
+ */
+inline std::string compressionSuffix(const Compression compression) {
+  switch (compression) {
+    case Compression::Gzip:
+      return ".gz";
+    case Compression::Zstd:
+      return ".zst";
+    default:
+      return "";
+  }
+}
+
+/**
+ * @brief The SegmentSink class is a single output file of the AsyncWriter,
+ *        which is written by the worker thread only.
+ */
+class SegmentSink {
+ public:
+  using Ptr = std::unique_ptr<SegmentSink>;
+
+  virtual ~SegmentSink() = default;
+
+  virtual bool isOpen() const = 0;
+
+  virtual void write(const char *data, const std::size_t size) = 0;
+
+  /**
+   * @brief Flush all pending data and finish the file.
+   */
+  virtual void close() = 0;
+
+  /**
+   * @brief Open a segment, unavailable compressions fall back to None.
+   * @param path        - the file, without the compression suffix
+   * @param compression - the compression
+   * @param level       - the compression level, zero selects the default
+   */
+  static inline Ptr open(const std::string &path, Compression compression,
+                         const int level);
+};
+
+class FileSink : public SegmentSink {
+ public:
+  inline explicit FileSink(const std::string &path)
+      : out_(path, std::ios::binary) {}
+
+  inline bool isOpen() const override { return out_.is_open(); }
+
+  inline void write(const char *data, const std::size_t size) override {
+    /// large writes bypass the stream buffer and end up in one writev
+    out_.write(data, static_cast<std::streamsize>(size));
+  }
+
+  inline void close() override {
+    if (out_.is_open()) {
+      out_.flush();
+      out_.close();
+    }
+  }
+
+ protected:
+  std::ofstream out_;
+};
+
+#ifdef CSLIBS_UTILITY_WITH_ZLIB
+class GzipSink : public FileSink {
+ public:
+  inline GzipSink(const std::string &path, const int level)
+      : FileSink(path), buffer_(1 << 16), closed_(false) {
+    stream_.zalloc = Z_NULL;
+    stream_.zfree = Z_NULL;
+    stream_.opaque = Z_NULL;
+    /// 15 + 16 selects the maximum window and the gzip container
+    if (deflateInit2(&stream_, level > 0 ? level : Z_DEFAULT_COMPRESSION,
+                     Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      FileSink::close();
+      closed_ = true;
+    }
+  }
+
+  inline ~GzipSink() override { close(); }
+
+  inline void write(const char *data, const std::size_t size) override {
+    if (closed_) return;
+    stream_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream_.avail_in = static_cast<uInt>(size);
+    deflateAll(Z_NO_FLUSH);
+  }
+
+  inline void close() override {
+    if (closed_) return;
+    stream_.next_in = Z_NULL;
+    stream_.avail_in = 0;
+    deflateAll(Z_FINISH);
+    deflateEnd(&stream_);
+    closed_ = true;
+    FileSink::close();
+  }
+
+ private:
+  z_stream stream_;
+  std::vector<char> buffer_;
+  bool closed_;
+
+  inline void deflateAll(const int flush) {
+    do {
+      stream_.next_out = reinterpret_cast<Bytef *>(buffer_.data());
+      stream_.avail_out = static_cast<uInt>(buffer_.size());
+      deflate(&stream_, flush);
+      FileSink::write(buffer_.data(), buffer_.size() - stream_.avail_out);
+    } while (stream_.avail_out == 0);
+  }
+};
+#endif
+
+#ifdef CSLIBS_UTILITY_WITH_ZSTD
+class ZstdSink : public FileSink {
+ public:
+  inline ZstdSink(const std::string &path, const int level)
+      : FileSink(path), context_(ZSTD_createCCtx()), buffer_(ZSTD_CStreamOutSize()) {
+    if (!context_) {
+      FileSink::close();
+      return;
+    }
+    ZSTD_CCtx_setParameter(context_, ZSTD_c_compressionLevel,
+                           level > 0 ? level : ZSTD_CLEVEL_DEFAULT);
+  }
+
+  inline ~ZstdSink() override { close(); }
+
+  inline void write(const char *data, const std::size_t size) override {
+    if (!context_) return;
+    ZSTD_inBuffer in{data, size, 0};
+    while (in.pos < in.size) {
+      ZSTD_outBuffer out{buffer_.data(), buffer_.size(), 0};
+      if (ZSTD_isError(ZSTD_compressStream2(context_, &out, &in, ZSTD_e_continue))) {
+        std::cerr << "[ZstdSink]: Compression failed!\n";
+        return;
+      }
+      FileSink::write(buffer_.data(), out.pos);
+    }
+  }
+
+  inline void close() override {
+    if (!context_) return;
+    ZSTD_inBuffer in{nullptr, 0, 0};
+    std::size_t remaining = 0;
+    do {
+      ZSTD_outBuffer out{buffer_.data(), buffer_.size(), 0};
+      remaining = ZSTD_compressStream2(context_, &out, &in, ZSTD_e_end);
+      if (ZSTD_isError(remaining)) {
+        std::cerr << "[ZstdSink]: Compression failed!\n";
+        break;
+      }
+      FileSink::write(buffer_.data(), out.pos);
+    } while (remaining != 0);
+    ZSTD_freeCCtx(context_);
+    context_ = nullptr;
+    FileSink::close();
+  }
+
+ private:
+  ZSTD_CCtx *context_;
+  std::vector<char> buffer_;
+};
+#endif
+
+inline SegmentSink::Ptr SegmentSink::open(const std::string &path,
+                                          Compression compression,
+                                          const int level) {
+  if (!compressionAvailable(compression)) {
+    std::cerr << "[SegmentSink]: Compression is not available, writing '"
+              << path << "' uncompressed.\n";
+    compression = Compression::None;
+  }
+  switch (compression) {
+#ifdef CSLIBS_UTILITY_WITH_ZLIB
+    case Compression::Gzip:
+      return Ptr(new GzipSink(path + compressionSuffix(compression), level));
+#endif
+#ifdef CSLIBS_UTILITY_WITH_ZSTD
+    case Compression::Zstd:
+      return Ptr(new ZstdSink(path + compressionSuffix(compression), level));
+#endif
+    default:
+      (void)level;
+      return Ptr(new FileSink(path));
+  }
+}
+}  // namespace logger
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_SEGMENT_SINK_HPP
@@ -0,0 +1,191 @@
+#ifndef CSLIBS_UTILITY_MEMORY_ARENA_HPP
+#define CSLIBS_UTILITY_MEMORY_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace cslibs_utility {
+namespace memory {
+/**
+ * @brief Bump a pointer within a block of memory.
+ * @return the aligned allocation, nullptr if it does not fit
+ */
+inline void* bump(std::size_t &offset, unsigned char *block, const std::size_t block_size,
+                  const std::size_t bytes, const std::size_t alignment)
+{
+    const std::uintptr_t base    = reinterpret_cast<std::uintptr_t>(block);
+    const std::uintptr_t aligned = (base + offset + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+    const std::size_t    begin   = static_cast<std::size_t>(aligned - base);
+    if(begin > block_size || bytes > block_size - begin)
+        return nullptr;
+    offset = begin + bytes;
+    return block + begin;
+}
+
+/**
+ * @brief The monotonic_arena class hands out memory by bumping a pointer,
+ *        deallocation is a no-op. Blocks are added geometrically when
+ *        exhausted and kept until release, reset rewinds into the largest
+ *        block so a steady workload allocates from a single block.
+ *        Not thread-safe.
+ */
+class monotonic_arena {
+public:
+    /**
+     * @brief monotonic_arena constructor.
+     * @param initial_size - size of the first block in bytes
+     */
+    inline explicit monotonic_arena(const std::size_t initial_size = 1 << 16) :
+        next_size_(std::max<std::size_t>(initial_size, 64)),
+        offset_(0),
+        allocated_(0)
+    {
+    }
+
+    monotonic_arena(const monotonic_arena &other) = delete;
+    monotonic_arena& operator = (const monotonic_arena &other) = delete;
+
+    inline void* allocate(const std::size_t bytes, const std::size_t alignment)
+    {
+        if(!blocks_.empty()) {
+            block &b = blocks_.back();
+            if(void *p = bump(offset_, b.data.get(), b.size, bytes, alignment)) {
+                allocated_ += bytes;
+                return p;
+            }
+        }
+        while(next_size_ < bytes + alignment)
+            next_size_ *= 2;
+        blocks_.push_back(block{std::unique_ptr<unsigned char[]>(new unsigned char[next_size_]), next_size_});
+        next_size_ *= 2;
+        offset_ = 0;
+        block &b = blocks_.back();
+        allocated_ += bytes;
+        return bump(offset_, b.data.get(), b.size, bytes, alignment);
+    }
+
+    inline void deallocate(void *, const std::size_t, const std::size_t)
+    {
+    }
+
+    /**
+     * @brief Invalidate all allocations. Except for the last, thus largest
+     *        block, all memory is returned to the system.
+     */
+    inline void reset()
+    {
+        if(blocks_.size() > 1)
+            blocks_.erase(blocks_.begin(), blocks_.end() - 1);
+        offset_    = 0;
+        allocated_ = 0;
+    }
+
+    /**
+     * @brief Invalidate all allocations and return all memory.
+     */
+    inline void release()
+    {
+        blocks_.clear();
+        offset_    = 0;
+        allocated_ = 0;
+    }
+
+    /**
+     * @brief Number of bytes handed out since the last reset.
+     */
+    inline std::size_t allocated() const
+    {
+        return allocated_;
+    }
+
+private:
+    struct block {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t                      size;
+    };
+
+    std::vector<block>  blocks_;
+    std::size_t         next_size_;
+    std::size_t         offset_;
+    std::size_t         allocated_;
+};
+
+/**
+ * @brief The frame_arena class is a fixed size bump allocator for scratch
+ *        data of a single cycle, which is discarded as a whole by reset in
+ *        O(1). Allocating more than the capacity throws std::bad_alloc.
+ *        Not thread-safe.
+ */
+class frame_arena {
+public:
+    /**
+     * @brief frame_arena constructor.
+     * @param capacity - size of the frame in bytes
+     */
+    inline explicit frame_arena(const std::size_t capacity) :
+        data_(new unsigned char[capacity]),
+        capacity_(capacity),
+        offset_(0),
+        high_water_mark_(0)
+    {
+    }
+
+    frame_arena(const frame_arena &other) = delete;
+    frame_arena& operator = (const frame_arena &other) = delete;
+
+    inline void* allocate(const std::size_t bytes, const std::size_t alignment)
+    {
+        void *p = bump(offset_, data_.get(), capacity_, bytes, alignment);
+        if(!p)
+            throw std::bad_alloc();
+        high_water_mark_ = std::max(high_water_mark_, offset_);
+        return p;
+    }
+
+    inline void deallocate(void *, const std::size_t, const std::size_t)
+    {
+    }
+
+    /**
+     * @brief Invalidate all allocations of the current frame.
+     */
+    inline void reset()
+    {
+        offset_ = 0;
+    }
+
+    inline std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    /**
+     * @brief Bytes used by the current frame.
+     */
+    inline std::size_t used() const
+    {
+        return offset_;
+    }
+
+    /**
+     * @brief Maximum number of bytes used by any frame, helps sizing.
+     */
+    inline std::size_t high_water_mark() const
+    {
+        return high_water_mark_;
+    }
+
+private:
+    std::unique_ptr<unsigned char[]>    data_;
+    const std::size_t                   capacity_;
+    std::size_t                         offset_;
+    std::size_t                         high_water_mark_;
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_MEMORY_ARENA_HPP
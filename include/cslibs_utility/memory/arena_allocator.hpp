@@ -0,0 +1,92 @@
+#ifndef CSLIBS_UTILITY_MEMORY_ARENA_ALLOCATOR_HPP
+#define CSLIBS_UTILITY_MEMORY_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <cslibs_utility/memory/arena.hpp>
+
+namespace cslibs_utility {
+namespace memory {
+/**
+ * @brief The arena_allocator class is a standard allocator drawing from an
+ *        arena, e.g. monotonic_arena or frame_arena. The arena has to
+ *        outlive all containers using it. Allocators compare equal if they
+ *        share the arena.
+ *
+ *        memory::frame_arena frame(1 << 20);
+ *        buffered::buffered_vector<float, memory::frame_allocator<float>> v(
+ *            0, 1024, memory::frame_allocator<float>(frame));
+ */
+template<typename T, typename Arena>
+class arena_allocator {
+public:
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// containers must not swap or move elements between arenas
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = arena_allocator<U, Arena>;
+    };
+
+    inline explicit arena_allocator(Arena &arena) noexcept :
+        arena_(&arena)
+    {
+    }
+
+    template<typename U>
+    inline arena_allocator(const arena_allocator<U, Arena> &other) noexcept :
+        arena_(other.arena())
+    {
+    }
+
+    inline T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    inline void deallocate(T *p, const std::size_t n) noexcept
+    {
+        arena_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    inline Arena* arena() const noexcept
+    {
+        return arena_;
+    }
+
+    template<typename U>
+    inline bool operator == (const arena_allocator<U, Arena> &other) const noexcept
+    {
+        return arena_ == other.arena();
+    }
+
+    template<typename U>
+    inline bool operator != (const arena_allocator<U, Arena> &other) const noexcept
+    {
+        return arena_ != other.arena();
+    }
+
+private:
+    Arena *arena_;
+};
+
+template<typename T>
+using monotonic_allocator = arena_allocator<T, monotonic_arena>;
+
+template<typename T>
+using frame_allocator = arena_allocator<T, frame_arena>;
+}
+}
+
+#endif // CSLIBS_UTILITY_MEMORY_ARENA_ALLOCATOR_HPP
@@ -0,0 +1,218 @@
+#ifndef CSLIBS_UTILITY_MEMORY_POOL_ALLOCATOR_HPP
+#define CSLIBS_UTILITY_MEMORY_POOL_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace cslibs_utility {
+namespace memory {
+/**
+ * @brief The fixed_pool class manages blocks of one size class. Each thread
+ *        allocates from and frees to its own free list without locking; only
+ *        refilling an empty free list and releasing a surplus touch the
+ *        shared store, which exchanges whole batches of blocks. Blocks may be
+ *        freed by any thread: once a free list exceeds two chunks worth of
+ *        blocks, one chunk worth is handed back to the shared store, so a
+ *        thread freeing the blocks allocated by another one, e.g. the
+ *        consumer of a queue, does not hoard them. The free lists of exiting
+ *        threads are handed back as well. Chunks are returned to the system
+ *        at program exit only.
+ */
+template<std::size_t Size, std::size_t Alignment>
+class fixed_pool {
+    struct node {
+        node *next;
+        node *next_batch;   /// only valid for the head of a batch in the shared store
+    };
+
+public:
+    static constexpr std::size_t alignment  = std::max(Alignment, alignof(node));
+    static constexpr std::size_t block_size = (std::max(Size, sizeof(node)) + alignment - 1) / alignment * alignment;
+    static constexpr std::size_t chunk_blocks = std::max<std::size_t>((1 << 16) / block_size, 16);
+
+    /**
+     * @brief The pool of the calling thread.
+     */
+    static inline fixed_pool& local()
+    {
+        thread_local fixed_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Number of chunks allocated from the system by all threads.
+     */
+    static inline std::size_t chunks()
+    {
+        shared_store &s = shared();
+        std::unique_lock<std::mutex> l(s.mutex);
+        return s.chunks.size();
+    }
+
+    inline ~fixed_pool()
+    {
+        if(free_)
+            release(free_);
+    }
+
+    inline void* allocate()
+    {
+        if(!free_)
+            refill();
+        node *n = free_;
+        free_ = n->next;
+        --count_;
+        return n;
+    }
+
+    inline void deallocate(void *p) noexcept
+    {
+        node *n = static_cast<node*>(p);
+        n->next = free_;
+        free_ = n;
+        if(++count_ >= 2 * chunk_blocks) {
+            /// split off the first chunk_blocks blocks
+            node *last = free_;
+            for(std::size_t i = 1 ; i < chunk_blocks ; ++i)
+                last = last->next;
+            node *batch = free_;
+            free_ = last->next;
+            last->next = nullptr;
+            count_ -= chunk_blocks;
+            release(batch);
+        }
+    }
+
+private:
+    struct shared_store {
+        std::mutex          mutex;
+        node               *batches = nullptr;
+        std::vector<void*>  chunks;
+
+        inline ~shared_store()
+        {
+            for(void *c : chunks)
+                ::operator delete(c, std::align_val_t(alignment));
+        }
+    };
+
+    node        *free_  = nullptr;
+    std::size_t  count_ = 0;
+
+    inline fixed_pool() = default;
+
+    static inline shared_store& shared()
+    {
+        static shared_store s;
+        return s;
+    }
+
+    static inline void release(node *batch) noexcept
+    {
+        shared_store &s = shared();
+        std::unique_lock<std::mutex> l(s.mutex);
+        batch->next_batch = s.batches;
+        s.batches = batch;
+    }
+
+    inline void refill()
+    {
+        shared_store &s = shared();
+        std::unique_lock<std::mutex> l(s.mutex);
+        if(s.batches) {
+            free_ = s.batches;
+            s.batches = s.batches->next_batch;
+            l.unlock();
+            /// batches hold at most two chunks worth of blocks
+            count_ = 0;
+            for(node *n = free_ ; n ; n = n->next)
+                ++count_;
+            return;
+        }
+        unsigned char *chunk = static_cast<unsigned char*>(
+                    ::operator new(chunk_blocks * block_size, std::align_val_t(alignment)));
+        s.chunks.push_back(chunk);
+        l.unlock();
+        for(std::size_t i = chunk_blocks ; i > 0 ; --i) {
+            node *n = reinterpret_cast<node*>(chunk + (i - 1) * block_size);
+            n->next = free_;
+            free_ = n;
+        }
+        count_ = chunk_blocks;
+    }
+};
+
+/**
+ * @brief The pool_allocator class serves single element allocations from a
+ *        thread-local fixed_pool, as done by node based containers like
+ *        std::list, std::map or the pb_ds heaps behind
+ *        synchronized::priority_queue. Array allocations fall back to the
+ *        global operator new. It is stateless, so all instances compare
+ *        equal.
+ */
+template<typename T>
+class pool_allocator {
+public:
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
+
+    inline pool_allocator() noexcept = default;
+
+    template<typename U>
+    inline pool_allocator(const pool_allocator<U> &) noexcept
+    {
+    }
+
+    inline T* allocate(const std::size_t n)
+    {
+        if(n == 1)
+            return static_cast<T*>(pool().allocate());
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    inline void deallocate(T *p, const std::size_t n) noexcept
+    {
+        if(n == 1)
+            pool().deallocate(p);
+        else
+            ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+
+    template<typename U>
+    inline bool operator == (const pool_allocator<U> &) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    inline bool operator != (const pool_allocator<U> &) const noexcept
+    {
+        return false;
+    }
+
+private:
+    /// T may be incomplete when the allocator is instantiated
+    static inline auto& pool()
+    {
+        return fixed_pool<sizeof(T), alignof(T)>::local();
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_MEMORY_POOL_ALLOCATOR_HPP
@@ -0,0 +1,391 @@
+#ifndef CSLIBS_UTILITY_METRICS_HPP
+#define CSLIBS_UTILITY_METRICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cslibs_utility {
+namespace metrics {
+/**
+ * Metrics are only recorded if CSLIBS_UTILITY_ENABLE_METRICS is defined,
+ * otherwise all handles are no-ops and the hooks within the library, e.g.
+ * the lock timing of synchronized::queue, are compiled out completely.
+ * The definition has to be consistent throughout a program.
+ */
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+enum class Kind { Counter, HighWater, Histogram };
+
+/// maximum number of distinct metrics
+constexpr std::size_t max_metrics = 256;
+/// bucket 0 holds zero, bucket b > 0 values within [2^(b-1), 2^b)
+constexpr std::size_t histogram_buckets = 65;
+
+/**
+ * @brief The accumulated state of a metric over all threads.
+ *        Counter   - count is the sum of all increments
+ *        HighWater - max is the maximum of all updates, count their number
+ *        Histogram - count, sum and max of all values and their log2 buckets
+ */
+struct Sample {
+    std::string                                     name;
+    Kind                                            kind;
+    std::uint64_t                                   count = 0;
+    std::uint64_t                                   sum   = 0;
+    std::uint64_t                                   max   = 0;
+    std::array<std::uint64_t, histogram_buckets>    buckets{};
+
+    inline double mean() const
+    {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Upper bound of the q-quantile of a histogram, exact up to a
+     *        factor of two.
+     * @param q - the quantile within [0, 1]
+     */
+    inline std::uint64_t quantile(const double q) const
+    {
+        const double rank = q * static_cast<double>(count);
+        std::uint64_t seen = 0;
+        for(std::size_t b = 0 ; b < histogram_buckets ; ++b) {
+            seen += buckets[b];
+            if(seen > 0 && static_cast<double>(seen) >= rank)
+                return b == 0 ? 0 : std::min(max, b == 64 ? UINT64_MAX : (std::uint64_t(1) << b) - 1);
+        }
+        return max;
+    }
+};
+
+struct Snapshot {
+    std::chrono::steady_clock::time_point   stamp;
+    std::vector<Sample>                     samples;
+
+    /**
+     * @return the sample called name, nullptr if there is none
+     */
+    inline const Sample* find(const std::string &name) const
+    {
+        for(const Sample &s : samples) {
+            if(s.name == name)
+                return &s;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Increase of a counter per second since an earlier snapshot,
+     *        e.g. the rows written per second.
+     */
+    inline double rate(const Snapshot &earlier, const std::string &name) const
+    {
+        const Sample *now  = find(name);
+        const Sample *then = earlier.find(name);
+        const double  dt   = std::chrono::duration<double>(stamp - earlier.stamp).count();
+        if(!now || dt <= 0.0)
+            return 0.0;
+        return static_cast<double>(now->count - (then ? then->count : 0)) / dt;
+    }
+};
+
+/**
+ * @brief The Registry class assigns ids to metric names and owns the per
+ *        thread storage. Each thread records into its own slots with plain
+ *        relaxed stores, so recording never synchronizes with other threads.
+ *        A snapshot sums up the slots of all live threads and those of
+ *        threads which have exited.
+ */
+class Registry {
+    struct Slot {
+        std::atomic<std::uint64_t>  count{0};
+        std::atomic<std::uint64_t>  sum{0};
+        std::atomic<std::uint64_t>  max{0};
+        std::atomic<std::uint64_t>  buckets[histogram_buckets] = {};
+    };
+
+    struct ThreadSlots {
+        std::array<std::atomic<Slot*>, max_metrics> slots = {};
+
+        inline ThreadSlots()
+        {
+            Registry::instance().attach(this);
+        }
+
+        inline ~ThreadSlots()
+        {
+            Registry::instance().detach(this);
+            for(auto &s : slots)
+                delete s.load(std::memory_order_relaxed);
+        }
+    };
+
+public:
+    static inline Registry& instance()
+    {
+        static Registry r;
+        return r;
+    }
+
+    /**
+     * @brief Get the id of a metric, which is registered on first use. Ids
+     *        are never released, once max_metrics names are registered the
+     *        error is reported and new metrics record nothing.
+     * @return the id, metrics with the same name share it, max_metrics if
+     *         the registry is full
+     */
+    inline std::size_t id(const std::string &name, const Kind kind)
+    {
+        std::unique_lock<std::mutex> l(mutex_);
+        for(std::size_t i = 0 ; i < names_.size() ; ++i) {
+            if(names_[i] == name)
+                return i;
+        }
+        if(names_.size() == max_metrics) {
+            std::cerr << "[metrics::Registry]: No id left for metric '" << name
+                      << "', it records nothing." << std::endl;
+            return max_metrics;
+        }
+        names_.emplace_back(name);
+        retired_.emplace_back();
+        retired_.back().name = name;
+        retired_.back().kind = kind;
+        return names_.size() - 1;
+    }
+
+    inline Snapshot snapshot() const
+    {
+        std::unique_lock<std::mutex> l(mutex_);
+        Snapshot snapshot;
+        snapshot.stamp   = std::chrono::steady_clock::now();
+        snapshot.samples = retired_;
+        for(const ThreadSlots *t : threads_) {
+            for(std::size_t i = 0 ; i < snapshot.samples.size() ; ++i) {
+                if(const Slot *s = t->slots[i].load(std::memory_order_acquire))
+                    accumulate(*s, snapshot.samples[i]);
+            }
+        }
+        return snapshot;
+    }
+
+private:
+    mutable std::mutex          mutex_;
+    std::vector<std::string>    names_;
+    std::vector<ThreadSlots*>   threads_;
+    std::vector<Sample>         retired_;   /// accumulated slots of exited threads
+
+    inline Registry() = default;
+
+    /**
+     * @brief The slot of metric id for the calling thread.
+     */
+    static inline Slot* local(const std::size_t id)
+    {
+        if(id >= max_metrics)
+            return nullptr;
+        thread_local ThreadSlots thread_slots;
+        std::atomic<Slot*> &s = thread_slots.slots[id];
+        Slot *slot = s.load(std::memory_order_relaxed);
+        if(!slot) {
+            slot = new Slot();
+            s.store(slot, std::memory_order_release);
+        }
+        return slot;
+    }
+
+    inline void attach(ThreadSlots *t)
+    {
+        std::unique_lock<std::mutex> l(mutex_);
+        threads_.emplace_back(t);
+    }
+
+    inline void detach(ThreadSlots *t)
+    {
+        std::unique_lock<std::mutex> l(mutex_);
+        threads_.erase(std::find(threads_.begin(), threads_.end(), t));
+        for(std::size_t i = 0 ; i < retired_.size() ; ++i) {
+            if(const Slot *s = t->slots[i].load(std::memory_order_relaxed))
+                accumulate(*s, retired_[i]);
+        }
+    }
+
+    static inline void accumulate(const Slot &s, Sample &sample)
+    {
+        sample.count += s.count.load(std::memory_order_relaxed);
+        sample.sum   += s.sum.load(std::memory_order_relaxed);
+        sample.max    = std::max(sample.max, s.max.load(std::memory_order_relaxed));
+        for(std::size_t b = 0 ; b < histogram_buckets ; ++b)
+            sample.buckets[b] += s.buckets[b].load(std::memory_order_relaxed);
+    }
+
+    template<Kind>
+    friend class Metric;
+};
+
+/**
+ * @brief The Metric class is the handle used for recording, it should be
+ *        created once, e.g. as function local static, since the registration
+ *        takes a lock. Recording is only done by the owning thread's slot.
+ */
+template<Kind kind>
+class Metric {
+public:
+    inline explicit Metric(const std::string &name) :
+        id_(enabled ? Registry::instance().id(name, kind) : max_metrics)
+    {
+    }
+
+    /**
+     * @brief Counter: add value, HighWater: update the maximum,
+     *        Histogram: record value.
+     */
+    inline void record(const std::uint64_t value) const
+    {
+        if constexpr (enabled) {
+            Registry::Slot *s = Registry::local(id_);
+            if(!s)
+                return;
+            if constexpr (kind == Kind::Counter) {
+                add(s->count, value);
+            } else {
+                add(s->count, 1);
+                if(value > s->max.load(std::memory_order_relaxed))
+                    s->max.store(value, std::memory_order_relaxed);
+                if constexpr (kind == Kind::Histogram) {
+                    add(s->sum, value);
+                    add(s->buckets[value == 0 ? 0 : 64 - __builtin_clzll(value)], 1);
+                }
+            }
+        }
+    }
+
+private:
+    std::size_t id_;
+
+    /// the slot is written by its thread only, thus no atomic read-modify-write
+    static inline void add(std::atomic<std::uint64_t> &a, const std::uint64_t v)
+    {
+        a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+};
+
+using Counter   = Metric<Kind::Counter>;
+using HighWater = Metric<Kind::HighWater>;
+using Histogram = Metric<Kind::Histogram>;
+
+inline std::uint64_t nanoseconds(const std::chrono::steady_clock::duration d)
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+}
+
+/**
+ * @brief Record the lifetime of the timer in nanoseconds.
+ */
+class ScopedTimer {
+public:
+    inline explicit ScopedTimer(const Histogram &histogram) :
+        histogram_(histogram),
+        start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    inline ~ScopedTimer()
+    {
+        histogram_.record(nanoseconds(std::chrono::steady_clock::now() - start_));
+    }
+
+private:
+    const Histogram                         &histogram_;
+    std::chrono::steady_clock::time_point    start_;
+};
+
+inline Snapshot snapshot()
+{
+    return Registry::instance().snapshot();
+}
+
+/**
+ * @brief The metrics of one container instance, recorded into
+ *        name + ".lock_wait_ns", name + ".lock_hold_ns" and name + ".depth".
+ *        Containers constructed with the same name share their metrics.
+ *        Without CSLIBS_UTILITY_ENABLE_METRICS it is empty.
+ */
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+struct ContainerMetrics {
+    Histogram   wait;
+    Histogram   hold;
+    HighWater   depth;
+
+    inline explicit ContainerMetrics(const std::string &name) :
+        wait(name + ".lock_wait_ns"),
+        hold(name + ".lock_hold_ns"),
+        depth(name + ".depth")
+    {
+    }
+};
+
+namespace detail {
+struct LockStamp {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+}
+
+/**
+ * @brief The TimedLock class is a std::unique_lock recording the time spent
+ *        waiting for the mutex and the time it was held into the wait and
+ *        hold histograms of a container. Without
+ *        CSLIBS_UTILITY_ENABLE_METRICS it is a plain std::unique_lock.
+ */
+template<typename Mutex>
+class TimedLock : private detail::LockStamp, public std::unique_lock<Mutex> {
+public:
+    inline TimedLock(Mutex &mutex, const ContainerMetrics &metrics) :
+        detail::LockStamp(),
+        std::unique_lock<Mutex>(mutex),
+        metrics_(metrics),
+        acquired_(std::chrono::steady_clock::now())
+    {
+        metrics_.wait.record(nanoseconds(acquired_ - start));
+    }
+
+    inline ~TimedLock()
+    {
+        if(this->owns_lock())
+            metrics_.hold.record(nanoseconds(std::chrono::steady_clock::now() - acquired_));
+    }
+
+private:
+    const ContainerMetrics                  &metrics_;
+    std::chrono::steady_clock::time_point    acquired_;
+};
+#else
+struct ContainerMetrics {
+    inline explicit ContainerMetrics(const std::string &)
+    {
+    }
+};
+
+template<typename Mutex>
+class TimedLock : public std::unique_lock<Mutex> {
+public:
+    inline TimedLock(Mutex &mutex, const ContainerMetrics &) :
+        std::unique_lock<Mutex>(mutex)
+    {
+    }
+};
+#endif
+}
+}
+
+#endif // CSLIBS_UTILITY_METRICS_HPP
@@ -0,0 +1,280 @@
+#ifndef CSLIBS_UTILITY_ASYNC_SIGNAL_HPP
+#define CSLIBS_UTILITY_ASYNC_SIGNAL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <cslibs_utility/common/delegate.hpp>
+#include <cslibs_utility/concurrency/thread_pool.hpp>
+#include <cslibs_utility/signals/signals.hpp>
+
+namespace cslibs_utility {
+namespace signals {
+/**
+ * @brief Argument types of the slot types supported by AsyncSignal.
+ */
+template<typename Slot>
+struct slot_traits;
+
+template<typename R, typename... A>
+struct slot_traits<std::function<R(A...)>>
+{
+    using args_t = std::tuple<typename std::decay<A>::type...>;
+};
+
+template<typename R, typename... A>
+struct slot_traits<common::delegate<R(A...)>>
+{
+    using args_t = std::tuple<typename std::decay<A>::type...>;
+};
+
+/**
+ * @brief What AsyncSignal does with an invocation if its queue is full.
+ */
+enum class AsyncPolicy {
+    DropNewest,  /// reject the new invocation
+    DropOldest,  /// replace the oldest pending invocation
+    Coalesce     /// keep only the latest pending invocation, capacity is one
+};
+
+/**
+ * @brief The AsyncSignal class defers the execution of slots to worker
+ *        threads. Invoking the signal copies the arguments into a bounded
+ *        queue, which is preallocated, thus an invocation costs about one
+ *        enqueue on the emitting thread. The slots are either executed by
+ *        worker threads of the signal or by tasks of a shared pool.
+ */
+template<typename Slot>
+class AsyncSignal {
+public:
+    typedef std::shared_ptr<AsyncSignal<Slot>> Ptr;
+    using signal_t   = Signal<Slot>;
+    using connection_t = typename signal_t::Connection;
+    using args_t     = typename slot_traits<Slot>::args_t;
+
+    /**
+     * @brief AsyncSignal constructor.
+     * @param _capacity - maximum number of pending invocations
+     * @param _policy   - what happens to invocations if the queue is full
+     * @param _threads  - number of worker threads executing the slots
+     */
+    AsyncSignal(const std::size_t _capacity = 64,
+                const AsyncPolicy _policy = AsyncPolicy::DropNewest,
+                const std::size_t _threads = 1) :
+        AsyncSignal(nullptr, _capacity, _policy, _threads)
+    {
+    }
+
+    /**
+     * @brief AsyncSignal constructor executing the slots on a shared pool.
+     *        Pending invocations are drained by pool tasks, which are only
+     *        scheduled while invocations are pending. flush must not be
+     *        called from a worker of the pool.
+     * @param _pool         - the pool executing the slots
+     * @param _capacity     - maximum number of pending invocations
+     * @param _policy       - what happens to invocations if the queue is full
+     * @param _concurrency  - maximum number of invocations executed at once
+     */
+    AsyncSignal(concurrency::thread_pool &_pool,
+                const std::size_t _capacity = 64,
+                const AsyncPolicy _policy = AsyncPolicy::DropNewest,
+                const std::size_t _concurrency = 1) :
+        AsyncSignal(&_pool, _capacity, _policy, _concurrency)
+    {
+    }
+
+    virtual ~AsyncSignal()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stop = true;
+        if(pool) {
+            /// the drain tasks execute all pending invocations
+            notify_idle.wait(lock, [this](){return active == 0;});
+            return;
+        }
+        lock.unlock();
+        notify_work.notify_all();
+        for(auto &w : workers) {
+            w.join();
+        }
+    }
+
+    void enable()
+    {
+        enabled = true;
+    }
+
+    void disable()
+    {
+        enabled = false;
+    }
+
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    template<typename Function>
+    typename connection_t::Ptr connect(Function&& _f)
+    {
+        return signal.connect(std::forward<Function>(_f));
+    }
+
+    void disconnect(typename connection_t::Ptr &_c)
+    {
+        signal.disconnect(_c);
+    }
+
+    /**
+     * @brief Enqueue an invocation of all slots.
+     * @return false if the signal is disabled or the invocation was dropped
+     */
+    template<typename... Args>
+    bool operator ()(Args&&... args)
+    {
+        if(!enabled)
+            return false;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if(pending == queue.size()) {
+            ++dropped;
+            if(policy == AsyncPolicy::DropNewest)
+                return false;
+            head = (head + 1) % queue.size();
+            --pending;
+        }
+        queue[(head + pending) % queue.size()] = args_t(std::forward<Args>(args)...);
+        ++pending;
+        if(pool) {
+            const bool schedule = active < max_active && active < pending;
+            if(schedule)
+                ++active;
+            lock.unlock();
+            if(schedule)
+                pool->execute([this](){drain();});
+            return true;
+        }
+        lock.unlock();
+        notify_work.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Block until all pending invocations have been executed.
+     */
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notify_idle.wait(lock, [this](){return pending == 0 && running == 0;});
+    }
+
+    /**
+     * @brief Number of invocations which were dropped or replaced.
+     */
+    std::size_t getDropped() const
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return dropped;
+    }
+
+private:
+    signal_t                    signal;
+    std::vector<std::thread>    workers;
+    concurrency::thread_pool   *pool;           /// executes drain tasks if set
+    const std::size_t           max_active;     /// maximum number of drain tasks
+    std::size_t                 active;         /// drain tasks scheduled
+
+    mutable std::mutex          mutex;
+    std::condition_variable     notify_work;
+    std::condition_variable     notify_idle;
+    std::vector<args_t>         queue;
+    std::size_t                 head;
+    std::size_t                 pending;
+    std::size_t                 running;
+    const AsyncPolicy           policy;
+    bool                        stop;
+    std::atomic_bool            enabled;
+    std::size_t                 dropped;
+
+    AsyncSignal(concurrency::thread_pool *_pool,
+                const std::size_t _capacity,
+                const AsyncPolicy _policy,
+                const std::size_t _threads) :
+        pool(_pool),
+        max_active(std::max<std::size_t>(_threads, 1)),
+        active(0),
+        queue(_policy == AsyncPolicy::Coalesce ? 1 : std::max<std::size_t>(_capacity, 1)),
+        head(0),
+        pending(0),
+        running(0),
+        policy(_policy),
+        stop(false),
+        enabled(false),
+        dropped(0)
+    {
+        signal.enable();
+        if(pool)
+            return;
+        for(std::size_t i = 0 ; i < max_active ; ++i) {
+            workers.emplace_back([this](){loop();});
+        }
+    }
+
+    /**
+     * @brief Pool task executing pending invocations until there are none.
+     */
+    void drain()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(pending > 0) {
+            args_t args = std::move(queue[head]);
+            head = (head + 1) % queue.size();
+            --pending;
+            ++running;
+            lock.unlock();
+
+            std::apply([this](auto &... a){signal(a...);}, args);
+
+            lock.lock();
+            --running;
+        }
+        --active;
+        /// wakes up flush and the destructor
+        notify_idle.notify_all();
+    }
+
+    void loop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for(;;) {
+            notify_work.wait(lock, [this](){return stop || pending > 0;});
+            if(pending == 0)
+                return;
+
+            args_t args = std::move(queue[head]);
+            head = (head + 1) % queue.size();
+            --pending;
+            ++running;
+            lock.unlock();
+
+            std::apply([this](auto &... a){signal(a...);}, args);
+
+            lock.lock();
+            --running;
+            if(pending == 0 && running == 0)
+                notify_idle.notify_all();
+        }
+    }
+};
+}
+}
+
+#endif /* CSLIBS_UTILITY_ASYNC_SIGNAL_HPP */
@@ -4,13 +4,28 @@
 #include <mutex>
 #include <memory>
 #include <atomic>
-#include <unordered_map>
+#include <condition_variable>
+#include <string>
+#include <vector>
+
+#include <cslibs_utility/metrics/metrics.hpp>
 
 namespace cslibs_utility {
 namespace signals {
 template<typename Slot>
 class Signal;
 
+/**
+ * @brief The Signal class calls all connected slots on invocation. The slots
+ *        are kept in a contiguous copy-on-write list: connect and disconnect
+ *        publish a new list atomically, whereas invocations only take a
+ *        snapshot of the current list and never wait for each other. A
+ *        disconnect sleeps until the invocations holding the previous list
+ *        have released it.
+ *        With CSLIBS_UTILITY_ENABLE_METRICS the execution time of the slots
+ *        is recorded into name + ".slot_ns", or into
+ *        name + "." + slot name + ".slot_ns" for slots connected with a name.
+ */
 template<typename Slot>
 class Signal : public std::enable_shared_from_this<Signal<Slot>> {
 public:
@@ -34,9 +49,20 @@ public:
         Signal &signal;
     };
 
-    Signal() :
+    /**
+     * @brief Signal constructor.
+     * @param _name - prefix of the slot metrics, signals of the same name
+     *                share their metrics
+     */
+    explicit Signal(const std::string &_name = "signals") :
+        name(_name),
+        retired(std::make_shared<retired_t>()),
         enabled(false)
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+        , time(name + ".slot_ns")
+#endif
     {
+        publish(std::unique_ptr<slots_t>(new slots_t));
     }
 
     void enable()
@@ -54,24 +80,73 @@ public:
         return enabled;
     }
 
+    /**
+     * @brief Connect a slot.
+     * @param _f    - the slot
+     * @param _name - records the slot into metrics of its own if not empty,
+     *                each name is registered once and never released, thus
+     *                names should not be generated per connection
+     */
     template<typename Function>
-    typename Connection::Ptr connect(Function&& _f)
+    typename Connection::Ptr connect(Function&& _f,
+                                     const std::string &_name = std::string())
     {
         typename Connection::Ptr c(new Signal::Connection(*this));
-        connections[c.get()] = std::forward<Function>(_f);
+        std::unique_lock<std::mutex> lock(mutex);
+        std::unique_ptr<slots_t> next(new slots_t(*std::atomic_load(&slots)));
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+        next->emplace_back(entry_t{c.get(), Slot(std::forward<Function>(_f)),
+                                   _name.empty() ? time : metrics::Histogram(name + "." + _name + ".slot_ns")});
+#else
+        (void) _name;
+        next->emplace_back(entry_t{c.get(), Slot(std::forward<Function>(_f))});
+#endif
+        publish(std::move(next));
         return c;
     }
 
     void disconnect(typename Connection::Ptr &_c)
     {
-        std::unique_lock<std::mutex> lock(mutex);
-        connections.erase(_c.get());
+        disconnect(_c.get());
     }
 
+    /**
+     * @brief Disconnect a slot. Returns only after all invocations which might
+     *        still call this slot have finished. Called from a slot during an
+     *        invocation of this signal, it returns right away instead, the
+     *        disconnected slot may then still be called by invocations in
+     *        progress, including the current one.
+     * @param _c - the connection of the slot
+     */
     void disconnect(Connection *_c)
     {
-        std::unique_lock<std::mutex> lock(mutex);
-        connections.erase(_c);
+        std::weak_ptr<const slots_t> previous;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            const std::shared_ptr<const slots_t> current = std::atomic_load(&slots);
+            std::unique_ptr<slots_t> next(new slots_t);
+            next->reserve(current->size());
+            for(const auto &s : *current) {
+                if(s.connection != _c)
+                    next->emplace_back(s);
+            }
+            publish(std::move(next));
+            previous = current;
+        }
+        /// the invocation of this thread holds the previous snapshot
+        if(emitting())
+            return;
+        /// wait for invocations holding the previous snapshot
+        std::unique_lock<std::mutex> lock(retired->mutex);
+        retired->released.wait(lock, [&previous](){return previous.expired();});
+    }
+
+    /**
+     * @brief Number of connected slots.
+     */
+    std::size_t size() const
+    {
+        return std::atomic_load(&slots)->size();
     }
 
     template<typename... Args>
@@ -80,16 +155,94 @@ public:
         if(!enabled)
             return;
 
-        std::unique_lock<std::mutex> lock(mutex);
-        for(auto &c : connections) {
-            c.second(args...);
+        const emission_t emission(this);
+        const std::shared_ptr<const slots_t> snapshot = std::atomic_load(&slots);
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+        for(const auto &s : *snapshot) {
+            metrics::ScopedTimer timer(s.time);
+            s.slot(args...);
         }
+#else
+        for(const auto &s : *snapshot) {
+            s.slot(args...);
+        }
+#endif
     }
 
 private:
-    std::mutex                              mutex;
-    std::unordered_map<Connection*, Slot>   connections;
+    struct entry_t {
+        Connection         *connection;
+        Slot                slot;
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+        metrics::Histogram  time;   /// execution time of the slot
+#endif
+    };
+    using slots_t = std::vector<entry_t>;
+
+    /// notified whenever the last snapshot of a list is released
+    struct retired_t {
+        std::mutex              mutex;
+        std::condition_variable released;
+    };
+
+    /// the invocations in progress on the calling thread, innermost first
+    struct emission_t {
+        const Signal        *signal;
+        const emission_t    *outer;
+
+        explicit emission_t(const Signal *_signal) :
+            signal(_signal),
+            outer(top())
+        {
+            top() = this;
+        }
+
+        ~emission_t()
+        {
+            top() = outer;
+        }
+
+        static const emission_t*& top()
+        {
+            thread_local const emission_t *emission = nullptr;
+            return emission;
+        }
+    };
+
+    const std::string                       name;
+    std::mutex                              mutex;  /// serializes connect and disconnect
+    std::shared_ptr<retired_t>              retired;
+    std::shared_ptr<const slots_t>          slots;
     std::atomic_bool                        enabled;
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+    metrics::Histogram                      time;   /// execution time of unnamed slots
+#endif
+
+    /**
+     * @brief Publish a new list of slots, the deleter wakes up disconnect
+     *        once the invocations holding the list are done.
+     */
+    void publish(std::unique_ptr<slots_t> &&next)
+    {
+        const std::shared_ptr<retired_t> r = retired;
+        std::atomic_store(&slots, std::shared_ptr<const slots_t>(next.release(), [r](const slots_t *s) {
+            delete s;
+            std::unique_lock<std::mutex> lock(r->mutex);
+            r->released.notify_all();
+        }));
+    }
+
+    /**
+     * @brief Whether the calling thread is within an invocation of this signal.
+     */
+    bool emitting() const
+    {
+        for(const emission_t *e = emission_t::top() ; e ; e = e->outer) {
+            if(e->signal == this)
+                return true;
+        }
+        return false;
+    }
 
 };
 }
@@ -0,0 +1,111 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_EVENT_COUNT_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_EVENT_COUNT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if !defined(__cpp_lib_atomic_wait) && defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The event_count class lets threads sleep until a lock-free
+ *        predicate becomes true. Waiting is built on std::atomic::wait if
+ *        available, on a futex on Linux and on yielding otherwise. Notifying
+ *        costs a fence and a load as long as nobody waits.
+ */
+class event_count
+{
+public:
+    using key_t = std::uint32_t;
+
+    inline event_count() :
+        epoch_(0),
+        waiters_(0)
+    {
+    }
+
+    event_count(const event_count &other) = delete;
+    event_count& operator = (const event_count &other) = delete;
+
+    /**
+     * @brief Block until the predicate returns true. The predicate has to
+     *        be safe to call repeatedly and should only have side effects
+     *        when it succeeds, e.g. a successful try_pop.
+     */
+    template<typename Predicate>
+    inline void await(Predicate &&predicate)
+    {
+        while(!predicate()) {
+            const key_t key = prepare_wait();
+            if(predicate()) {
+                cancel_wait();
+                return;
+            }
+            wait(key);
+        }
+    }
+
+    /**
+     * @brief Wake up all waiting threads, to be called after the state
+     *        checked by the predicates was changed.
+     */
+    inline void notify_all()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waiters_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+#if defined(__cpp_lib_atomic_wait)
+        epoch_.notify_all();
+#elif defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<key_t*>(&epoch_),
+                  FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+private:
+    std::atomic<key_t> epoch_;
+    std::atomic<key_t> waiters_;
+
+    inline key_t prepare_wait()
+    {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_seq_cst);
+    }
+
+    inline void cancel_wait()
+    {
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline void wait(const key_t key)
+    {
+#if defined(__cpp_lib_atomic_wait)
+        epoch_.wait(key, std::memory_order_seq_cst);
+#elif defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<key_t*>(&epoch_),
+                  FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+#else
+        while(epoch_.load(std::memory_order_seq_cst) == key)
+            std::this_thread::yield();
+#endif
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SYNCHRONIZED_EVENT_COUNT_HPP
@@ -0,0 +1,220 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_MPMC_QUEUE_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <cslibs_utility/synchronized/event_count.hpp>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The mpmc_queue class is a lock-free bounded ring buffer for any
+ *        number of producers and consumers. Slots carry sequence numbers
+ *        following the bounded queue design of D. Vyukov, thus an operation
+ *        costs one compare-and-swap on the respective index.
+ * @param _Tp       - element type
+ * @param _Blocking - whether push and pop sleep on a futex instead of
+ *                    yielding, costs a fence per operation
+ */
+template<typename _Tp, bool _Blocking = true>
+class mpmc_queue
+{
+public:
+    /**
+     * @brief mpmc_queue constructor.
+     * @param _capacity - number of slots, rounded up to the next power of two
+     */
+    inline explicit mpmc_queue(const std::size_t _capacity = 1024) :
+        capacity_(roundUp(_capacity)),
+        mask_(capacity_ - 1),
+        cells_(new cell[capacity_]),
+        enqueue_pos_(0),
+        dequeue_pos_(0)
+    {
+        for(std::size_t i = 0 ; i < capacity_ ; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    inline ~mpmc_queue()
+    {
+        while(try_consume([](_Tp &){}));
+    }
+
+    mpmc_queue(const mpmc_queue &other) = delete;
+    mpmc_queue& operator = (const mpmc_queue &other) = delete;
+
+    inline std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    inline bool empty() const
+    {
+        return size() == 0;
+    }
+
+    inline bool hasElements() const
+    {
+        return !empty();
+    }
+
+    /**
+     * @brief Number of elements, only a snapshot while other threads are
+     *        pushing or popping.
+     */
+    inline std::size_t size() const
+    {
+        const std::size_t dequeue = dequeue_pos_.load(std::memory_order_acquire);
+        const std::size_t enqueue = enqueue_pos_.load(std::memory_order_acquire);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    /**
+     * @brief Construct an element in place.
+     * @return false if the queue is full
+     */
+    template<typename... Args>
+    inline bool try_emplace(Args&&... args)
+    {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        cell *c;
+        for(;;) {
+            c = &cells_[pos & mask_];
+            const std::size_t seq = c->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0) {
+                if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if(diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        new (c->storage) _Tp(std::forward<Args>(args)...);
+        c->sequence.store(pos + 1, std::memory_order_release);
+        if constexpr (_Blocking)
+            not_empty_.notify_all();
+        return true;
+    }
+
+    inline bool try_push(const _Tp &t)
+    {
+        return try_emplace(t);
+    }
+
+    inline bool try_push(_Tp &&t)
+    {
+        return try_emplace(std::move(t));
+    }
+
+    /**
+     * @brief Move the oldest element out of the queue.
+     * @return false if the queue is empty
+     */
+    inline bool try_pop(_Tp &t)
+    {
+        return try_consume([&t](_Tp &e){t = std::move(e);});
+    }
+
+    /**
+     * @brief Construct an element in place, waits while the queue is full.
+     */
+    template<typename... Args>
+    inline void emplace(Args&&... args)
+    {
+        await(not_full_, [&](){return try_emplace(std::forward<Args>(args)...);});
+    }
+
+    inline void push(const _Tp &t)
+    {
+        emplace(t);
+    }
+
+    inline void push(_Tp &&t)
+    {
+        emplace(std::move(t));
+    }
+
+    /**
+     * @brief Remove the oldest element, waits while the queue is empty.
+     */
+    inline _Tp pop()
+    {
+        std::optional<_Tp> t;
+        await(not_empty_, [&](){return try_consume([&t](_Tp &e){t.emplace(std::move(e));});});
+        return std::move(*t);
+    }
+
+private:
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct cell {
+        std::atomic<std::size_t>            sequence;
+        alignas(_Tp) unsigned char          storage[sizeof(_Tp)];
+    };
+
+    const std::size_t                                   capacity_;
+    const std::size_t                                   mask_;
+    std::unique_ptr<cell[]>                             cells_;
+    alignas(cache_line_size) std::atomic<std::size_t>   enqueue_pos_;
+    alignas(cache_line_size) std::atomic<std::size_t>   dequeue_pos_;
+    alignas(cache_line_size) event_count                not_empty_;
+    alignas(cache_line_size) event_count                not_full_;
+
+    static inline std::size_t roundUp(const std::size_t capacity)
+    {
+        std::size_t c = 2;
+        while(c < capacity)
+            c <<= 1;
+        return c;
+    }
+
+    template<typename Consumer>
+    inline bool try_consume(Consumer &&consumer)
+    {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        cell *c;
+        for(;;) {
+            c = &cells_[pos & mask_];
+            const std::size_t seq = c->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if(diff == 0) {
+                if(dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if(diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        _Tp *t = std::launder(reinterpret_cast<_Tp*>(c->storage));
+        consumer(*t);
+        t->~_Tp();
+        c->sequence.store(pos + capacity_, std::memory_order_release);
+        if constexpr (_Blocking)
+            not_full_.notify_all();
+        return true;
+    }
+
+    template<typename Predicate>
+    static inline void await(event_count &event, Predicate &&predicate)
+    {
+        if constexpr (_Blocking) {
+            event.await(std::forward<Predicate>(predicate));
+        } else {
+            while(!predicate())
+                std::this_thread::yield();
+        }
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SYNCHRONIZED_MPMC_QUEUE_HPP
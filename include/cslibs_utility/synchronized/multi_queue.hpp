@@ -0,0 +1,197 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_MULTI_QUEUE_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_MULTI_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The multi_queue class is a relaxed concurrent priority queue. It
+ *        consists of several heaps with a lock each, elements are pushed to
+ *        a random heap and popped from the better of two random heaps, so
+ *        threads rarely contend for the same lock. In exchange, try_pop_top
+ *        returns one of the best elements instead of the best one, the
+ *        expected rank error grows with the number of heaps.
+ * @param _Tp       - comparable data types
+ * @param _Compare  - comparing data types, like std::priority_queue the
+ *                    greatest element is popped first
+ */
+template <typename _Tp, typename _Compare = std::less<_Tp>>
+class multi_queue {
+ public:
+  using mutex_t = std::mutex;
+  using lock_t = std::unique_lock<mutex_t>;
+
+  /**
+   * @brief multi_queue constructor.
+   * @param threads     - number of threads expected to access the queue
+   * @param relaxation  - heaps per thread, one heap in total gives a
+   *                      strict priority queue
+   * @param compare     - the comparison function object
+   */
+  inline explicit multi_queue(
+      const std::size_t threads = std::thread::hardware_concurrency(),
+      const std::size_t relaxation = 2, const _Compare &compare = _Compare())
+      : compare_(compare),
+        heaps_(std::max<std::size_t>(threads * relaxation, 1)),
+        size_(0) {}
+
+  multi_queue(const multi_queue &other) = delete;
+  multi_queue &operator=(const multi_queue &other) = delete;
+
+  inline bool empty() const { return size() == 0; }
+
+  inline bool hasElements() const { return !empty(); }
+
+  /**
+   * @brief Number of elements, only a snapshot while other threads are
+   *        pushing or popping.
+   */
+  inline std::size_t size() const {
+    return size_.load(std::memory_order_acquire);
+  }
+
+  template <typename... Args>
+  inline void emplace(Args &&... args) {
+    heap &h = lockAny();
+    lock_t l(h.mutex, std::adopt_lock);
+    h.emplace(compare_, std::forward<Args>(args)...);
+    size_.fetch_add(1, std::memory_order_release);
+  }
+
+  inline void push(const _Tp &t) { emplace(t); }
+
+  inline void push(_Tp &&t) { emplace(std::move(t)); }
+
+  /**
+   * @brief Push a range of elements under a single lock, use
+   *        std::make_move_iterator to move them.
+   */
+  template <typename Iterator>
+  inline void push_range(Iterator first, Iterator last) {
+    heap &h = lockAny();
+    lock_t l(h.mutex, std::adopt_lock);
+    std::size_t n = 0;
+    for (; first != last; ++first, ++n) {
+      h.emplace(compare_, *first);
+    }
+    size_.fetch_add(n, std::memory_order_release);
+  }
+
+  /**
+   * @brief Remove one of the top elements.
+   * @return the removed element, nothing if the queue was found empty
+   */
+  inline std::optional<_Tp> try_pop_top() {
+    const std::size_t n = heaps_.size();
+    for (std::size_t attempt = 0; attempt < n; ++attempt) {
+      if (empty()) {
+        return std::nullopt;
+      }
+      heap &a = heaps_[random() % n];
+      heap &b = heaps_[random() % n];
+      lock_t la(a.mutex, std::try_to_lock);
+      if (!la.owns_lock()) {
+        continue;
+      }
+      lock_t lb;
+      if (&a != &b) {
+        lb = lock_t(b.mutex, std::try_to_lock);
+      }
+      heap *best = &a;
+      if (lb.owns_lock() && !b.data.empty() &&
+          (a.data.empty() || compare_(a.data.front(), b.data.front()))) {
+        best = &b;
+      }
+      if (!best->data.empty()) {
+        return pop(*best);
+      }
+    }
+    // fall back to sweeps, concurrent pushes may land behind the sweep, so
+    // it is repeated until an element is found or the queue is empty
+    while (!empty()) {
+      for (auto &h : heaps_) {
+        lock_t l(h.mutex);
+        if (!h.data.empty()) {
+          return pop(h);
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  inline void clear() {
+    for (auto &h : heaps_) {
+      lock_t l(h.mutex);
+      size_.fetch_sub(h.data.size(), std::memory_order_release);
+      h.data.clear();
+    }
+  }
+
+ private:
+  static constexpr std::size_t cache_line_size = 64;
+
+  struct alignas(cache_line_size) heap {
+    mutex_t mutex;
+    std::vector<_Tp> data;
+
+    template <typename... Args>
+    inline void emplace(const _Compare &compare, Args &&... args) {
+      data.emplace_back(std::forward<Args>(args)...);
+      std::push_heap(data.begin(), data.end(), compare);
+    }
+  };
+
+  const _Compare compare_;
+  std::vector<heap> heaps_;
+  alignas(cache_line_size) std::atomic<std::size_t> size_;
+
+  /**
+   * @brief Thread-local xorshift generator for the heap selection.
+   */
+  static inline std::uint64_t random() {
+    thread_local std::uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) |
+        std::uint64_t(1);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+
+  /**
+   * @brief Lock a random heap, trying another one if its lock is taken.
+   */
+  inline heap &lockAny() {
+    const std::size_t n = heaps_.size();
+    for (std::size_t attempt = 0; attempt < n; ++attempt) {
+      heap &h = heaps_[random() % n];
+      if (h.mutex.try_lock()) {
+        return h;
+      }
+    }
+    heap &h = heaps_[random() % n];
+    h.mutex.lock();
+    return h;
+  }
+
+  inline _Tp pop(heap &h) {
+    std::pop_heap(h.data.begin(), h.data.end(), compare_);
+    _Tp t = std::move(h.data.back());
+    h.data.pop_back();
+    size_.fetch_sub(1, std::memory_order_release);
+    return t;
+  }
+};
+}  // namespace synchronized
+}  // namespace cslibs_utility
+
+#endif  // CSLIBS_UTILITY_SYNCHRONIZED_MULTI_QUEUE_HPP
@@ -0,0 +1,118 @@
+#ifndef CSLIBS_UTILITY_SEQLOCK_HPP
+#define CSLIBS_UTILITY_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The SeqLock class holds small trivially copyable state for many
+ *        readers and rare writers. Readers never block writers: a read
+ *        copies the state optimistically and retries if a write interfered,
+ *        which is detected by a sequence number that is odd while a write is
+ *        in progress. Writers are serialized among each other.
+ */
+template<typename data_t>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<data_t>::value,
+                  "SeqLock requires trivially copyable data.");
+
+public:
+    inline SeqLock() :
+        SeqLock(data_t())
+    {
+    }
+
+    inline explicit SeqLock(const data_t &data) :
+        sequence_(0)
+    {
+        word_t words[size] = {};
+        std::memcpy(words, &data, sizeof(data_t));
+        for(std::size_t i = 0 ; i < size ; ++i)
+            words_[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    SeqLock(const SeqLock &other) = delete;
+    SeqLock& operator = (const SeqLock &other) = delete;
+
+    /**
+     * @brief Read a consistent copy of the state, retries while writes are
+     *        in progress.
+     */
+    inline data_t load() const
+    {
+        data_t data;
+        while(!try_load(data))
+            std::this_thread::yield();
+        return data;
+    }
+
+    /**
+     * @brief Read a consistent copy of the state with a single attempt.
+     * @return false if a write interfered, data is unspecified then
+     */
+    inline bool try_load(data_t &data) const
+    {
+        const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+        if(before & 1)
+            return false;
+        word_t words[size];
+        for(std::size_t i = 0 ; i < size ; ++i)
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence_.load(std::memory_order_relaxed) != before)
+            return false;
+        std::memcpy(&data, words, sizeof(data_t));
+        return true;
+    }
+
+    inline void store(const data_t &data)
+    {
+        modify([&data](data_t &d){d = data;});
+    }
+
+    /**
+     * @brief Read, modify and write the state as one write.
+     */
+    template<typename Function>
+    inline void modify(Function &&function)
+    {
+        std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        while((sequence & 1) ||
+              !sequence_.compare_exchange_weak(sequence, sequence + 1,
+                                               std::memory_order_acquire)) {
+            std::this_thread::yield();
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        word_t words[size];
+        for(std::size_t i = 0 ; i < size ; ++i)
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        data_t data;
+        std::memcpy(&data, words, sizeof(data_t));
+        function(data);
+        std::memcpy(words, &data, sizeof(data_t));
+        for(std::size_t i = 0 ; i < size ; ++i)
+            words_[i].store(words[i], std::memory_order_relaxed);
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    using word_t = std::uint64_t;
+    static constexpr std::size_t size = (sizeof(data_t) + sizeof(word_t) - 1) / sizeof(word_t);
+
+    /// the state is copied word by word with atomic accesses, so concurrent
+    /// reads and writes do not race
+    std::atomic<std::uint64_t>  sequence_;
+    std::atomic<word_t>         words_[size];
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SEQLOCK_HPP
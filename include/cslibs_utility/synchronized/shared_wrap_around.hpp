@@ -0,0 +1,134 @@
+#ifndef CSLIBS_UTILITY_SHARED_WRAP_AROUND_HPP
+#define CSLIBS_UTILITY_SHARED_WRAP_AROUND_HPP
+
+#include <shared_mutex>
+#include <type_traits>
+#include <assert.h>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The SharedWrapAround class is the reader-writer counterpart of
+ *        WrapAround. A const data_t takes a shared lock, thus any number of
+ *        readers can hold one at a time; a mutable data_t takes the lock
+ *        exclusively.
+ *
+ *        SharedWrapAround<const map_t> reader(&map, &mutex);
+ *        SharedWrapAround<map_t>       writer(&map, &mutex);
+ */
+template<typename data_t>
+class SharedWrapAround {
+public:
+    using mutex_t = std::shared_mutex;
+
+    static constexpr bool shared = std::is_const<data_t>::value;
+
+    inline SharedWrapAround() :
+        data_(nullptr),
+        mutex_(nullptr)
+    {
+    }
+
+    inline explicit SharedWrapAround(data_t  *data,
+                                     mutex_t *mutex) :
+        data_(data),
+        mutex_(mutex)
+    {
+        assert(mutex != nullptr);
+        assert(data  != nullptr);
+        if(data_) {
+            lock();
+        }
+    }
+
+    SharedWrapAround(const SharedWrapAround &other) = delete;
+    SharedWrapAround& operator = (const SharedWrapAround &other) = delete;
+
+    inline SharedWrapAround(SharedWrapAround &&other) :
+        data_(other.data_),
+        mutex_(other.mutex_)
+    {
+        other.data_  = nullptr;
+        other.mutex_ = nullptr;
+    }
+
+    inline SharedWrapAround& operator = (SharedWrapAround &&other)
+    {
+        if(this != &other) {
+            if(data_) {
+                unlock();
+            }
+            data_  = other.data_;
+            mutex_ = other.mutex_;
+            other.data_  = nullptr;
+            other.mutex_ = nullptr;
+        }
+        return *this;
+    }
+
+    virtual inline ~SharedWrapAround()
+    {
+        if(data_) {
+            unlock();
+        }
+    }
+
+    inline bool empty() const
+    {
+        return data_ == nullptr;
+    }
+
+    inline const data_t& data() const
+    {
+        return *data_;
+    }
+
+    inline data_t& data()
+    {
+        return *data_;
+    }
+
+    inline operator data_t* ()
+    {
+        return data_;
+    }
+
+    inline operator data_t const *() const
+    {
+        return data_;
+    }
+
+    inline data_t * operator -> ()
+    {
+        return data_;
+    }
+
+    inline data_t const * operator -> () const
+    {
+        return data_;
+    }
+
+private:
+    data_t  *data_;
+    mutex_t *mutex_;
+
+    inline void lock()
+    {
+        if constexpr (shared)
+            mutex_->lock_shared();
+        else
+            mutex_->lock();
+    }
+
+    inline void unlock()
+    {
+        if constexpr (shared)
+            mutex_->unlock_shared();
+        else
+            mutex_->unlock();
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SHARED_WRAP_AROUND_HPP
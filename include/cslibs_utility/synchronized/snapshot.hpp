@@ -0,0 +1,91 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_SNAPSHOT_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_SNAPSHOT_HPP
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The snapshot class publishes immutable values to any number of
+ *        readers. Readers grab the newest complete value as shared pointer
+ *        and keep it alive as long as they need, publishing swaps the pointer
+ *        only. The writer reuses the previous value's storage once no reader
+ *        holds it anymore, so steady state publishing does not allocate.
+ */
+template<typename _Tp>
+class snapshot
+{
+public:
+    using ptr_t       = std::shared_ptr<_Tp>;
+    using const_ptr_t = std::shared_ptr<const _Tp>;
+
+    inline snapshot() :
+        snapshot(_Tp())
+    {
+    }
+
+    inline explicit snapshot(const _Tp &t) :
+        current_(std::make_shared<_Tp>(t))
+    {
+    }
+
+    snapshot(const snapshot &other) = delete;
+    snapshot& operator = (const snapshot &other) = delete;
+
+    /**
+     * @brief The newest value, never blocks on the writer.
+     */
+    inline const_ptr_t load() const
+    {
+        return std::atomic_load(&current_);
+    }
+
+    /**
+     * @brief Storage for the next value, writer only. Recycles the value
+     *        replaced by the last publish if no reader holds it anymore, its
+     *        content is unspecified then.
+     */
+    inline ptr_t acquire()
+    {
+        ptr_t spare = std::move(spare_);
+        if(spare && spare.use_count() == 1) {
+            // pairs with the release of the last reader's reference
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return spare;
+        }
+        return std::make_shared<_Tp>();
+    }
+
+    /**
+     * @brief Make t the newest value, writer only.
+     */
+    inline void publish(ptr_t t)
+    {
+        spare_ = std::atomic_exchange(&current_, std::move(t));
+    }
+
+    inline void store(const _Tp &t)
+    {
+        ptr_t p = acquire();
+        *p = t;
+        publish(std::move(p));
+    }
+
+    inline void store(_Tp &&t)
+    {
+        ptr_t p = acquire();
+        *p = std::move(t);
+        publish(std::move(p));
+    }
+
+private:
+    ptr_t current_;
+    /// writer-owned, the value replaced by the last publish
+    ptr_t spare_;
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SYNCHRONIZED_SNAPSHOT_HPP
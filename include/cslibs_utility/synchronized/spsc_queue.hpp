@@ -0,0 +1,188 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_SPSC_QUEUE_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <cslibs_utility/synchronized/event_count.hpp>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The spsc_queue class is a lock-free bounded ring buffer for exactly
+ *        one producer and one consumer thread. Each side caches the index of
+ *        the other side, so the shared indices are only read when the ring
+ *        looks full or empty.
+ * @param _Tp       - element type
+ * @param _N        - capacity, a power of two
+ * @param _Blocking - whether push and pop sleep on a futex instead of
+ *                    yielding, costs a fence per operation
+ */
+template<typename _Tp, std::size_t _N, bool _Blocking = true>
+class spsc_queue
+{
+    static_assert(_N >= 2 && (_N & (_N - 1)) == 0,
+                  "spsc_queue capacity must be a power of two.");
+
+public:
+    inline spsc_queue() :
+        tail_(0),
+        head_cache_(0),
+        head_(0),
+        tail_cache_(0)
+    {
+    }
+
+    inline ~spsc_queue()
+    {
+        while(try_consume([](_Tp &){}));
+    }
+
+    spsc_queue(const spsc_queue &other) = delete;
+    spsc_queue& operator = (const spsc_queue &other) = delete;
+
+    static constexpr std::size_t capacity()
+    {
+        return _N;
+    }
+
+    inline bool empty() const
+    {
+        return size() == 0;
+    }
+
+    inline bool hasElements() const
+    {
+        return !empty();
+    }
+
+    inline std::size_t size() const
+    {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @brief Construct an element in place, producer only.
+     * @return false if the queue is full
+     */
+    template<typename... Args>
+    inline bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if(tail - head_cache_ == _N) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if(tail - head_cache_ == _N)
+                return false;
+        }
+        new (slot(tail)) _Tp(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        if constexpr (_Blocking)
+            not_empty_.notify_all();
+        return true;
+    }
+
+    inline bool try_push(const _Tp &t)
+    {
+        return try_emplace(t);
+    }
+
+    inline bool try_push(_Tp &&t)
+    {
+        return try_emplace(std::move(t));
+    }
+
+    /**
+     * @brief Move the oldest element out of the queue, consumer only.
+     * @return false if the queue is empty
+     */
+    inline bool try_pop(_Tp &t)
+    {
+        return try_consume([&t](_Tp &e){t = std::move(e);});
+    }
+
+    /**
+     * @brief Construct an element in place, waits while the queue is full.
+     */
+    template<typename... Args>
+    inline void emplace(Args&&... args)
+    {
+        await(not_full_, [&](){return try_emplace(std::forward<Args>(args)...);});
+    }
+
+    inline void push(const _Tp &t)
+    {
+        emplace(t);
+    }
+
+    inline void push(_Tp &&t)
+    {
+        emplace(std::move(t));
+    }
+
+    /**
+     * @brief Remove the oldest element, waits while the queue is empty.
+     */
+    inline _Tp pop()
+    {
+        std::optional<_Tp> t;
+        await(not_empty_, [&](){return try_consume([&t](_Tp &e){t.emplace(std::move(e));});});
+        return std::move(*t);
+    }
+
+private:
+    static constexpr std::size_t cache_line_size = 64;
+    static constexpr std::size_t mask = _N - 1;
+
+    /// producer side
+    alignas(cache_line_size) std::atomic<std::size_t> tail_;
+    std::size_t                                       head_cache_;
+    /// consumer side
+    alignas(cache_line_size) std::atomic<std::size_t> head_;
+    std::size_t                                       tail_cache_;
+
+    alignas(cache_line_size) event_count not_empty_;
+    alignas(cache_line_size) event_count not_full_;
+    alignas(cache_line_size) alignas(_Tp) unsigned char storage_[_N][sizeof(_Tp)];
+
+    inline void* slot(const std::size_t index)
+    {
+        return storage_[index & mask];
+    }
+
+    template<typename Consumer>
+    inline bool try_consume(Consumer &&consumer)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if(head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if(head == tail_cache_)
+                return false;
+        }
+        _Tp *t = std::launder(reinterpret_cast<_Tp*>(slot(head)));
+        consumer(*t);
+        t->~_Tp();
+        head_.store(head + 1, std::memory_order_release);
+        if constexpr (_Blocking)
+            not_full_.notify_all();
+        return true;
+    }
+
+    template<typename Predicate>
+    static inline void await(event_count &event, Predicate &&predicate)
+    {
+        if constexpr (_Blocking) {
+            event.await(std::forward<Predicate>(predicate));
+        } else {
+            while(!predicate())
+                std::this_thread::yield();
+        }
+    }
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SYNCHRONIZED_SPSC_QUEUE_HPP
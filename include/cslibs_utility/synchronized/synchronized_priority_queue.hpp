@@ -4,6 +4,9 @@
 #include <ext/pb_ds/priority_queue.hpp>
 #include <mutex>
 #include <queue>
+#include <string>
+
+#include <cslibs_utility/metrics/metrics.hpp>
 
 namespace cslibs_utility {
 namespace synchronized {
@@ -18,45 +21,83 @@ template <typename _Tp, typename _Compare = std::less<_Tp>,
 class priority_queue {
  public:
   using mutex_t = std::mutex;
-  using lock_t = std::unique_lock<mutex_t>;
+  /// records lock wait and hold times if CSLIBS_UTILITY_ENABLE_METRICS is
+  /// defined
+  using lock_t = metrics::TimedLock<mutex_t>;
   using queue_t =
       __gnu_pbds::priority_queue<_Tp, _Compare,
                                  __gnu_pbds::rc_binomial_heap_tag, _Alloctor>;
+  /// stable reference to an element, valid until the element is removed
+  using handle_t = typename queue_t::point_iterator;
 
-  inline priority_queue() = default;
+  /**
+   * @brief priority_queue constructor.
+   * @param name  - prefix of the lock and depth metrics of this queue
+   */
+  inline explicit priority_queue(
+      const std::string &name = "synchronized.priority_queue")
+      : metrics_(name) {}
   inline ~priority_queue() { q_.clear(); }
 
   inline bool empty() const {
-    lock_t l(mutex_);
+    lock_t l(mutex_, metrics_);
     return q_.empty();
   }
 
   inline bool hasElements() const { return !empty(); }
 
   inline std::size_t size() const {
-    lock_t l(mutex_);
+    lock_t l(mutex_, metrics_);
     return q_.size();
   }
 
   inline _Tp pop() {
-    lock_t l(mutex_);
+    lock_t l(mutex_, metrics_);
     _Tp t = q_.top();
     q_.pop();
     return t;
   }
 
-  inline _Tp const &top() const {
-    lock_t l(mutex_);
+  inline _Tp top() const {
+    lock_t l(mutex_, metrics_);
     return q_.top();
   }
 
-  inline void emplace(const _Tp &t) {
-    lock_t l(mutex_);
-    q_.push(t);
+  /**
+   * @brief Insert an element.
+   * @return handle to update or erase the element later on
+   */
+  inline handle_t emplace(const _Tp &t) {
+    lock_t l(mutex_, metrics_);
+    const handle_t handle = q_.push(t);
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+    metrics_.depth.record(q_.size());
+#endif
+    return handle;
+  }
+
+  /**
+   * @brief Replace the value of an element and restore the heap order, e.g.
+   *        to decrease the key of a search node in place.
+   * @param handle  - handle of an element still in the queue
+   * @param t       - the new value
+   */
+  inline void update(handle_t handle, const _Tp &t) {
+    lock_t l(mutex_, metrics_);
+    q_.modify(handle, t);
+  }
+
+  /**
+   * @brief Remove an element.
+   * @param handle  - handle of an element still in the queue
+   */
+  inline void erase(handle_t handle) {
+    lock_t l(mutex_, metrics_);
+    q_.erase(handle);
   }
 
   inline void clear() {
-    lock_t l(mutex_);
+    lock_t l(mutex_, metrics_);
     while (!q_.empty()) {
       q_.pop();
     }
@@ -65,6 +106,7 @@ class priority_queue {
  private:
   mutable mutex_t mutex_;
   queue_t q_;
+  metrics::ContainerMetrics metrics_;
 };
 }  // namespace synchronized
 }  // namespace cslibs_utility
@@ -1,8 +1,14 @@
 #ifndef CSLIBS_UTILITY_SYNCHRONIZED_QUEUE_HPP
 #define CSLIBS_UTILITY_SYNCHRONIZED_QUEUE_HPP
 
+#include <chrono>
+#include <condition_variable>
 #include <queue>
 #include <mutex>
+#include <string>
+#include <vector>
+
+#include <cslibs_utility/metrics/metrics.hpp>
 
 namespace cslibs_utility {
 namespace synchronized {
@@ -11,13 +17,21 @@ class queue
 {
 public:
     using mutex_t = std::mutex;
-    using lock_t  = std::unique_lock<mutex_t>;
+    /// records lock wait and hold times if CSLIBS_UTILITY_ENABLE_METRICS is defined
+    using lock_t  = metrics::TimedLock<mutex_t>;
 
-    inline queue() = default;
+    /**
+     * @brief queue constructor.
+     * @param name - prefix of the lock and depth metrics of this queue
+     */
+    inline explicit queue(const std::string &name = "synchronized.queue") :
+        metrics_(name)
+    {
+    }
 
     inline bool empty() const
     {
-        lock_t l(mutex_);
+        lock_t l(mutex_, metrics_);
         return q_.empty();
     }
 
@@ -28,39 +42,152 @@ public:
 
     inline std::size_t size() const
     {
-        lock_t l(mutex_);
+        lock_t l(mutex_, metrics_);
         return q_.size();
     }
 
+    /**
+     * @brief Remove the oldest element, the queue must not be empty.
+     */
     inline _Tp pop()
     {
-        lock_t l(mutex_);
-        _Tp t = q_.front();
+        lock_t l(mutex_, metrics_);
+        _Tp t = std::move(q_.front());
+        q_.pop();
+        return t;
+    }
+
+    /**
+     * @brief Remove the oldest element if there is one.
+     * @return false if the queue was empty
+     */
+    inline bool try_pop(_Tp &t)
+    {
+        lock_t l(mutex_, metrics_);
+        if(q_.empty())
+            return false;
+        t = std::move(q_.front());
+        q_.pop();
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element, waits while the queue is empty.
+     */
+    inline _Tp wait_pop()
+    {
+        /// not timed, the time spent waiting for data is no lock contention
+        std::unique_lock<mutex_t> l(mutex_);
+        not_empty_.wait(l, [this](){return !q_.empty();});
+        _Tp t = std::move(q_.front());
         q_.pop();
         return t;
     }
 
-    inline _Tp const & top() const
+    /**
+     * @brief Remove the oldest element, waits at most timeout while the
+     *        queue is empty.
+     * @return false if the queue was still empty after timeout
+     */
+    template<typename Rep, typename Period>
+    inline bool wait_pop(_Tp &t, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        std::unique_lock<mutex_t> l(mutex_);
+        if(!not_empty_.wait_for(l, timeout, [this](){return !q_.empty();}))
+            return false;
+        t = std::move(q_.front());
+        q_.pop();
+        return true;
+    }
+
+    /**
+     * @brief Move all elements to the end of ts under a single lock.
+     * @return the number of elements moved
+     */
+    inline std::size_t pop_all(std::vector<_Tp> &ts)
     {
-        lock_t l(mutex_);
+        lock_t l(mutex_, metrics_);
+        const std::size_t n = q_.size();
+        ts.reserve(ts.size() + n);
+        while(!q_.empty()) {
+            ts.emplace_back(std::move(q_.front()));
+            q_.pop();
+        }
+        return n;
+    }
+
+    /**
+     * @brief Copy of the oldest element, the queue must not be empty. A
+     *        reference would outlive the lock while others pop the element.
+     */
+    inline _Tp top() const
+    {
+        lock_t l(mutex_, metrics_);
         return q_.front();
     }
 
-    inline void emplace(const _Tp &t)
+    /**
+     * @brief Copy the oldest element if there is one.
+     * @return false if the queue was empty
+     */
+    inline bool try_top(_Tp &t) const
+    {
+        lock_t l(mutex_, metrics_);
+        if(q_.empty())
+            return false;
+        t = q_.front();
+        return true;
+    }
+
+    template<typename... Args>
+    inline void emplace(Args&&... args)
     {
-        lock_t l(mutex_);
-        q_.emplace(t);
+        {
+            lock_t l(mutex_, metrics_);
+            q_.emplace(std::forward<Args>(args)...);
+            recordDepth();
+        }
+        not_empty_.notify_one();
     }
 
     inline void push(const _Tp &t)
     {
-        lock_t l(mutex_);
-        q_.push(t);
+        emplace(t);
+    }
+
+    inline void push(_Tp &&t)
+    {
+        emplace(std::move(t));
+    }
+
+    /**
+     * @brief Append a range of elements under a single lock, use
+     *        std::make_move_iterator to move them.
+     */
+    template<typename Iterator>
+    inline void push_range(Iterator first, Iterator last)
+    {
+        {
+            lock_t l(mutex_, metrics_);
+            for(; first != last ; ++first)
+                q_.emplace(*first);
+            recordDepth();
+        }
+        not_empty_.notify_all();
     }
 
 private:
     mutable mutex_t mutex_;
+    std::condition_variable not_empty_;
     std::queue<_Tp, _Sequence> q_;
+    metrics::ContainerMetrics metrics_;
+
+    inline void recordDepth() const
+    {
+#ifdef CSLIBS_UTILITY_ENABLE_METRICS
+        metrics_.depth.record(q_.size());
+#endif
+    }
 };
 }
 }
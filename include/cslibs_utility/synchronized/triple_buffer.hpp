@@ -0,0 +1,105 @@
+#ifndef CSLIBS_UTILITY_SYNCHRONIZED_TRIPLE_BUFFER_HPP
+#define CSLIBS_UTILITY_SYNCHRONIZED_TRIPLE_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace cslibs_utility {
+namespace synchronized {
+/**
+ * @brief The triple_buffer class hands the latest value from one writer to
+ *        one reader, neither of them ever blocks or copies. The writer fills
+ *        its back buffer and publishes it by swapping it with the middle
+ *        buffer, the reader swaps the middle buffer with its front buffer if
+ *        a newer value was published. Values published before the reader
+ *        looked are overwritten, so the reader always sees the newest one.
+ */
+template<typename _Tp>
+class triple_buffer
+{
+public:
+    inline triple_buffer() :
+        triple_buffer(_Tp())
+    {
+    }
+
+    inline explicit triple_buffer(const _Tp &t) :
+        buffers_{t, t, t},
+        back_(0),
+        middle_(1),
+        front_(2)
+    {
+    }
+
+    triple_buffer(const triple_buffer &other) = delete;
+    triple_buffer& operator = (const triple_buffer &other) = delete;
+
+    /**
+     * @brief The buffer to be filled by the writer, it still holds the
+     *        value published two writes ago.
+     */
+    inline _Tp& write_buffer()
+    {
+        return buffers_[back_];
+    }
+
+    /**
+     * @brief Make the write buffer the newest value, writer only.
+     */
+    inline void publish()
+    {
+        back_ = middle_.exchange(back_ | dirty, std::memory_order_acq_rel) & index;
+    }
+
+    inline void write(const _Tp &t)
+    {
+        write_buffer() = t;
+        publish();
+    }
+
+    inline void write(_Tp &&t)
+    {
+        write_buffer() = std::move(t);
+        publish();
+    }
+
+    /**
+     * @brief Fetch the newest value if one was published, reader only.
+     * @return whether the front buffer changed
+     */
+    inline bool update()
+    {
+        if(!(middle_.load(std::memory_order_relaxed) & dirty))
+            return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & index;
+        return true;
+    }
+
+    /**
+     * @brief The newest value, reader only. The reference stays valid until
+     *        the next call of read or update.
+     */
+    inline const _Tp& read()
+    {
+        update();
+        return buffers_[front_];
+    }
+
+private:
+    static constexpr std::uint8_t index = 0x3;
+    static constexpr std::uint8_t dirty = 0x4;
+    static constexpr std::size_t  cache_line_size = 64;
+
+    _Tp                                                 buffers_[3];
+    /// writer side
+    alignas(cache_line_size) std::uint8_t               back_;
+    /// index of the middle buffer, flagged dirty if not read yet
+    alignas(cache_line_size) std::atomic<std::uint8_t>  middle_;
+    /// reader side
+    alignas(cache_line_size) std::uint8_t               front_;
+};
+}
+}
+
+#endif // CSLIBS_UTILITY_SYNCHRONIZED_TRIPLE_BUFFER_HPP
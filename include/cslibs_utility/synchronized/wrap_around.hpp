@@ -6,13 +6,19 @@
 
 namespace cslibs_utility {
 namespace synchronized {
+/**
+ * @brief The WrapAround class grants access to data guarded by a mutex,
+ *        which is locked for the lifetime of the object. It can be moved
+ *        but not copied, thus the mutex is unlocked exactly once.
+ */
 template<typename data_t>
 class WrapAround {
 public:
     using mutex_t = std::mutex;
 
     inline WrapAround() :
-        data_(nullptr)
+        data_(nullptr),
+        mutex_(nullptr)
     {
     }
 
@@ -28,10 +34,30 @@ public:
         }
     }
 
-    inline WrapAround(const WrapAround &other) = default;
-    inline WrapAround(WrapAround &&other) = default;
-    inline WrapAround& operator = (const WrapAround &other) = default;
-    inline WrapAround& operator = (WrapAround &&other) = default;
+    WrapAround(const WrapAround &other) = delete;
+    WrapAround& operator = (const WrapAround &other) = delete;
+
+    inline WrapAround(WrapAround &&other) :
+        data_(other.data_),
+        mutex_(other.mutex_)
+    {
+        other.data_  = nullptr;
+        other.mutex_ = nullptr;
+    }
+
+    inline WrapAround& operator = (WrapAround &&other)
+    {
+        if(this != &other) {
+            if(data_) {
+                mutex_->unlock();
+            }
+            data_  = other.data_;
+            mutex_ = other.mutex_;
+            other.data_  = nullptr;
+            other.mutex_ = nullptr;
+        }
+        return *this;
+    }
 
     virtual inline ~WrapAround()
     {
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <cslibs_utility/logger/binary_reader.hpp>
+#include <cslibs_utility/logger/binary_to_csv.hpp>
+#include <cslibs_utility/logger/binary_writer.hpp>
+#include <cslibs_utility/logger/csv_reader.hpp>
+
+TEST(Test_cslibs_utility, binaryWriterReader) {
+  using writer_t =
+      cslibs_utility::logger::BinaryWriter<int, double, bool, std::uint8_t>;
+  using reader_t =
+      cslibs_utility::logger::BinaryReader<int, double, bool, std::uint8_t>;
+
+  const std::size_t rows = 10000;
+  writer_t::header_t h{"int", "double", "bool", "byte"};
+  {
+    writer_t w{h, "/tmp/cslibs_utility_test.bin"};
+    for (std::size_t j = 0; j < rows; ++j) {
+      w.write(-static_cast<int>(j), 0.1 * j, j % 2 == 0,
+              static_cast<std::uint8_t>(j));
+    }
+  }
+
+  reader_t r{"/tmp/cslibs_utility_test.bin"};
+  ASSERT_TRUE(r.hasHeader());
+  EXPECT_EQ(r.getHeader(), h);
+  ASSERT_EQ(r.getData().size(), rows);
+  for (std::size_t j = 0; j < rows; ++j) {
+    const auto &entry = r.getData()[j];
+    EXPECT_EQ(std::get<0>(entry), -static_cast<int>(j));
+    EXPECT_EQ(std::get<1>(entry), 0.1 * j);
+    EXPECT_EQ(std::get<2>(entry), j % 2 == 0);
+    EXPECT_EQ(std::get<3>(entry), static_cast<std::uint8_t>(j));
+  }
+
+  EXPECT_FALSE(r.isTruncated());
+
+  cslibs_utility::logger::BinaryReader<long, double, bool, std::uint8_t>
+      mismatch{"/tmp/cslibs_utility_test.bin"};
+  EXPECT_FALSE(mismatch.hasHeader());
+  EXPECT_TRUE(mismatch.getData().empty());
+
+  /// cut the last record in half
+  {
+    std::ifstream in("/tmp/cslibs_utility_test.bin", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)),
+                      std::istreambuf_iterator<char>());
+    bytes.resize(bytes.size() - reader_t::record_size / 2);
+    std::ofstream out("/tmp/cslibs_utility_test_truncated.bin",
+                      std::ios::binary);
+    out << bytes;
+  }
+  reader_t truncated{"/tmp/cslibs_utility_test_truncated.bin"};
+  EXPECT_TRUE(truncated.isTruncated());
+  ASSERT_EQ(truncated.getData().size(), rows - 1);
+  EXPECT_EQ(truncated.getData().back(), r.getData()[rows - 2]);
+  EXPECT_FALSE(cslibs_utility::logger::convertBinaryToCSV(
+      "/tmp/cslibs_utility_test_truncated.bin",
+      "/tmp/cslibs_utility_test_truncated.csv"));
+}
+
+TEST(Test_cslibs_utility, binaryToCSV) {
+  using writer_t = cslibs_utility::logger::BinaryWriter<long, float>;
+  using reader_t = cslibs_utility::logger::CSVReader<long, float>;
+
+  {
+    writer_t w{{"stamp", "value"}, "/tmp/cslibs_utility_test_convert.bin"};
+    for (long j = 0; j < 100; ++j) {
+      w.write(1000 + j, 0.5f * j);
+    }
+  }
+  ASSERT_TRUE(cslibs_utility::logger::convertBinaryToCSV(
+      "/tmp/cslibs_utility_test_convert.bin",
+      "/tmp/cslibs_utility_test_convert.csv"));
+
+  reader_t r{"/tmp/cslibs_utility_test_convert.csv", true};
+  EXPECT_EQ(r.getHeader().front(), "stamp");
+  EXPECT_EQ(r.getHeader().back(), "value");
+  ASSERT_EQ(r.getData().size(), 100ul);
+  for (long j = 0; j < 100; ++j) {
+    EXPECT_EQ(std::get<0>(r.getData()[j]), 1000 + j);
+    EXPECT_EQ(std::get<1>(r.getData()[j]), 0.5f * j);
+  }
+
+  EXPECT_FALSE(cslibs_utility::logger::convertBinaryToCSV(
+      "/tmp/cslibs_utility_test_convert.csv",
+      "/tmp/cslibs_utility_test_convert_invalid.csv"));
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cslibs_utility/buffered/buffered_vector.hpp>
+#include <cslibs_utility/buffered/static_buffered_vector.hpp>
+
+using cslibs_utility::buffered::buffered_vector;
+using cslibs_utility::buffered::default_init_buffered_vector;
+using cslibs_utility::buffered::static_buffered_vector;
+
+namespace {
+std::size_t allocations = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U> &) {}
+  T *allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>::allocate(n);
+  }
+};
+using counted_t = std::vector<int, counting_allocator<int>>;
+}  // namespace
+
+TEST(Test_cslibs_utility, bufferedVectorFixed) {
+  buffered_vector<int> v(0, 2);
+  v.push_back(1);
+  EXPECT_EQ(v.emplace_back(2), 2);
+  EXPECT_THROW(v.push_back(3), std::runtime_error);
+  EXPECT_EQ(v.size(), 2ul);
+  EXPECT_EQ(v.capacity(), 2ul);
+
+  v.clear();
+  v.push_back(4);
+  EXPECT_EQ(v.back(), 4);
+  EXPECT_EQ(v.capacity(), 2ul);
+}
+
+TEST(Test_cslibs_utility, bufferedVectorGrowable) {
+  buffered_vector<std::string> v(0, 1);
+  v.set_growable(true);
+  for (int i = 0; i < 10; ++i) {
+    v.emplace_back(3, static_cast<char>('a' + i));
+  }
+  EXPECT_EQ(v.size(), 10ul);
+  EXPECT_EQ(v.capacity(), 16ul);
+  EXPECT_EQ(v[9], "jjj");
+
+  // the capacity is kept across cycles
+  v.resize(0, 4);
+  EXPECT_EQ(v.capacity(), 16ul);
+  v.clear();
+  std::string s(64, 'x');
+  v.push_back(std::move(s));
+  EXPECT_EQ(v.front(), std::string(64, 'x'));
+
+  buffered_vector<std::unique_ptr<int>> p(0, 1);
+  p.set_growable(true);
+  p.emplace_back(new int(1));
+  p.push_back(std::make_unique<int>(2));
+  EXPECT_EQ(*p.back(), 2);
+}
+
+TEST(Test_cslibs_utility, bufferedVectorGrowAliasing) {
+  // the argument refers to an entry released by growing
+  buffered_vector<std::string> v(0, 1);
+  v.set_growable(true);
+  v.push_back(std::string(100, 'a'));
+  v.push_back(v.front());
+  EXPECT_EQ(v.capacity(), 2ul);
+  EXPECT_EQ(v.back(), std::string(100, 'a'));
+  v.emplace_back(v[1], 0, 10);
+  EXPECT_EQ(v.back(), std::string(10, 'a'));
+  v.push_back(std::move(v.front()));
+  EXPECT_EQ(v.size(), 4ul);
+  EXPECT_EQ(v.back(), std::string(100, 'a'));
+  const std::string &back = v.back();
+  v.push_back(back);
+  EXPECT_EQ(v[4], std::string(100, 'a'));
+}
+
+TEST(Test_cslibs_utility, bufferedVectorRefillAllocations) {
+  // refilling assigns to the entries, which keep their buffers
+  const counted_t value(16, 1);
+  buffered_vector<counted_t> v(0, 4);
+  static_buffered_vector<counted_t, 4> s;
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(value);
+    s.push_back(value);
+  }
+  v.clear();
+  s.clear();
+  allocations = 0;
+  for (int i = 0; i < 2; ++i) {
+    v.push_back(value);
+    v.emplace_back(value);
+    s.push_back(value);
+    s.emplace_back(value);
+  }
+  EXPECT_EQ(allocations, 0ul);
+  EXPECT_EQ(v.back(), value);
+  EXPECT_EQ(s.back(), value);
+}
+
+TEST(Test_cslibs_utility, bufferedVectorDefaultInit) {
+  default_init_buffered_vector<float> v;
+  v.reserve_uninitialized(1 << 20);
+  EXPECT_EQ(v.capacity(), 1ul << 20);
+  EXPECT_EQ(v.size(), 0ul);
+  v.push_back(1.f);
+  EXPECT_EQ(v[0], 1.f);
+
+  default_init_buffered_vector<float> w(4, 4, 2.f);
+  EXPECT_EQ(w.at(3), 2.f);
+}
+
+TEST(Test_cslibs_utility, staticBufferedVector) {
+  static_buffered_vector<std::string, 3> v;
+  EXPECT_EQ(v.capacity(), 3ul);
+  v.push_back("a");
+  v.emplace_back(2, 'b');
+  v.push_back(std::string("c"));
+  EXPECT_THROW(v.push_back("d"), std::runtime_error);
+  EXPECT_EQ(v.back(), "c");
+  EXPECT_EQ(v.end() - v.begin(), 3);
+  EXPECT_EQ(v.limit() - v.begin(), 3);
+
+  v.clear();
+  EXPECT_EQ(v.size(), 0ul);
+  EXPECT_THROW(v.at(0), std::runtime_error);
+  v.resize(2, 3);
+  EXPECT_EQ(v.size(), 2ul);
+  EXPECT_EQ(v[1], "bb");
+  EXPECT_THROW(v.resize(4), std::runtime_error);
+  EXPECT_THROW(v.resize(1, 4), std::runtime_error);
+
+  // resize has the semantics of buffered_vector::resize
+  buffered_vector<std::string> b(0, 3);
+  v.resize(3);
+  b.resize(3);
+  EXPECT_EQ(v.size(), b.size());
+  EXPECT_EQ(v.capacity(), b.capacity());
+  v.resize(1, 2);
+  b.resize(1, 2);
+  EXPECT_EQ(v.size(), b.size());
+  EXPECT_EQ(v.capacity(), b.capacity());
+  EXPECT_EQ(v.limit() - v.begin(), b.limit() - b.begin());
+  v.push_back("x");
+  b.push_back("x");
+  EXPECT_THROW(v.push_back("y"), std::runtime_error);
+  EXPECT_THROW(b.push_back("y"), std::runtime_error);
+  EXPECT_THROW(v.emplace_back(1, 'y'), std::runtime_error);
+  v.clear();
+  b.clear();
+  EXPECT_EQ(v.capacity(), b.capacity());
+  v.resize(3);
+  EXPECT_EQ(v.capacity(), 3ul);
+  EXPECT_EQ(v.max_capacity(), 3ul);
+
+  static_buffered_vector<float, 4> f(4, 1.f);
+  EXPECT_EQ(f.at(3), 1.f);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
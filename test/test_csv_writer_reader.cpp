@@ -1,7 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_column_reader.hpp>
+#include <cslibs_utility/logger/csv_formatter.hpp>
+#include <cslibs_utility/logger/csv_logger.hpp>
+#include <cslibs_utility/logger/csv_merge_reader.hpp>
 #include <cslibs_utility/logger/csv_reader.hpp>
+#include <cslibs_utility/logger/csv_schema_reader.hpp>
+#include <cslibs_utility/logger/csv_schema_writer.hpp>
+#include <cslibs_utility/logger/csv_stream_reader.hpp>
 #include <cslibs_utility/logger/csv_writer.hpp>
+#include <cslibs_utility/logger/row_ring_buffer.hpp>
 
 TEST(Test_cslibs_utility, csvWriterReader) {
   using writer_t = cslibs_utility::logger::CSVWriter<int, double>;
@@ -29,6 +42,567 @@ TEST(Test_cslibs_utility, csvWriterReader) {
   }
 }
 
+TEST(Test_cslibs_utility, csvReaderMapped) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, double, std::string>;
+  using reader_t = cslibs_utility::logger::CSVReader<int, double, std::string>;
+  using cslibs_utility::logger::CSVReadMode;
+
+  const std::size_t rows = 1000;
+  {
+    writer_t w{{"int", "double", "string"}, "/tmp/cslibs_utility_test_mapped.csv"};
+    for (std::size_t j = 0; j < rows; ++j) {
+      w.write(static_cast<int>(j) - 500, 0.1 * j, "s" + std::to_string(j));
+    }
+  }
+
+  reader_t stream{"/tmp/cslibs_utility_test_mapped.csv", true};
+  reader_t mapped{"/tmp/cslibs_utility_test_mapped.csv", true, CSVReadMode::Mapped};
+  ASSERT_TRUE(mapped.hasHeader());
+  EXPECT_EQ(mapped.getHeader(), stream.getHeader());
+  ASSERT_EQ(mapped.getData().size(), rows);
+  EXPECT_EQ(mapped.getData(), stream.getData());
+
+  {
+    std::ofstream out("/tmp/cslibs_utility_test_malformed.csv");
+    out << "1,2.5,a\r\n"
+        << "\n"
+        << "2,x,b\n"
+        << "3,3.5\n"
+        << "4,4.5,d,surplus\n"
+        << "12abc,6.5,f\n"
+        << "1.5,7.5,g\n"
+        << "8,8.5x,h\n"
+        << " 5, 5.5,e";
+  }
+  reader_t malformed{"/tmp/cslibs_utility_test_malformed.csv", false,
+                     CSVReadMode::Mapped};
+  const reader_t::data_t expected{
+      {1, 2.5, "a"}, {4, 4.5, "d"}, {5, 5.5, "e"}};
+  EXPECT_EQ(malformed.getData(), expected);
+
+  reader_t missing{"/tmp/cslibs_utility_test_does_not_exist.csv", true,
+                   CSVReadMode::Mapped};
+  EXPECT_FALSE(missing.hasHeader());
+  EXPECT_TRUE(missing.getData().empty());
+}
+
+TEST(Test_cslibs_utility, csvReaderParallel) {
+  using writer_t = cslibs_utility::logger::CSVWriter<long, double, int>;
+  using reader_t = cslibs_utility::logger::CSVReader<long, double, int>;
+  using cslibs_utility::logger::CSVReadMode;
+
+  const long rows = 200000;
+  {
+    writer_t w{"/tmp/cslibs_utility_test_parallel.csv"};
+    for (long j = 0; j < rows; ++j) {
+      w.write(1000000000L + j, 0.001 * j, static_cast<int>(j % 7));
+    }
+  }
+
+  reader_t mapped{"/tmp/cslibs_utility_test_parallel.csv", false,
+                  CSVReadMode::Mapped};
+  reader_t parallel{"/tmp/cslibs_utility_test_parallel.csv", false,
+                    CSVReadMode::Parallel, 4};
+  ASSERT_EQ(parallel.getData().size(), static_cast<std::size_t>(rows));
+  EXPECT_EQ(parallel.getData(), mapped.getData());
+
+  cslibs_utility::concurrency::thread_pool pool(3);
+  reader_t pooled{"/tmp/cslibs_utility_test_parallel.csv", false, pool};
+  EXPECT_EQ(pooled.getData(), mapped.getData());
+
+  const std::string buffer = "a\nbb\nccc\ndddd\n";
+  const auto chunks = cslibs_utility::logger::splitChunks(
+      buffer.data(), buffer.data() + buffer.size(), 3);
+  std::string joined;
+  for (const auto &c : chunks) {
+    EXPECT_EQ(*(c.second - 1), '\n');
+    joined.append(c.first, c.second);
+  }
+  EXPECT_EQ(joined, buffer);
+  EXPECT_LE(chunks.size(), 3ul);
+}
+
+TEST(Test_cslibs_utility, csvColumnReader) {
+  using reader_t = cslibs_utility::logger::CSVReader<long, double, int>;
+  using column_reader_t = cslibs_utility::logger::CSVColumnReader<long, double, int>;
+  using cslibs_utility::logger::CSVReadMode;
+
+  /// written by csvReaderParallel
+  reader_t rows{"/tmp/cslibs_utility_test_parallel.csv", false,
+                CSVReadMode::Mapped};
+  for (const std::size_t threads : {1ul, 4ul}) {
+    column_reader_t columns{"/tmp/cslibs_utility_test_parallel.csv", false,
+                            threads};
+    ASSERT_EQ(columns.rows(), rows.getData().size());
+    for (std::size_t j = 0; j < columns.rows(); ++j) {
+      EXPECT_EQ(columns.getColumn<0>()[j], std::get<0>(rows.getData()[j]));
+      EXPECT_EQ(columns.getColumn<1>()[j], std::get<1>(rows.getData()[j]));
+      EXPECT_EQ(columns.getColumn<2>()[j], std::get<2>(rows.getData()[j]));
+    }
+  }
+
+  cslibs_utility::concurrency::thread_pool pool(3);
+  column_reader_t pooled{"/tmp/cslibs_utility_test_parallel.csv", false, pool};
+  ASSERT_EQ(pooled.rows(), rows.getData().size());
+  EXPECT_EQ(pooled.getColumn<1>().back(), std::get<1>(rows.getData().back()));
+
+  /// written by csvReaderMapped
+  cslibs_utility::logger::CSVColumnReader<int, double, std::string> malformed{
+      "/tmp/cslibs_utility_test_malformed.csv"};
+  EXPECT_EQ(malformed.rows(), 3ul);
+  EXPECT_EQ(malformed.getColumn<0>(), (std::vector<int>{1, 4, 5}));
+  EXPECT_EQ(malformed.getColumn<2>(), (std::vector<std::string>{"a", "d", "e"}));
+}
+
+TEST(Test_cslibs_utility, csvStreamReader) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, std::string>;
+  using reader_t = cslibs_utility::logger::CSVReader<int, std::string>;
+  using stream_reader_t = cslibs_utility::logger::CSVStreamReader<int, std::string>;
+  using cslibs_utility::logger::CSVReadMode;
+
+  const std::size_t rows = 500;
+  {
+    writer_t w{{"int", "string"}, "/tmp/cslibs_utility_test_stream.csv"};
+    for (std::size_t j = 0; j < rows; ++j) {
+      w.write(static_cast<int>(j), std::string(j % 100, 'x'));
+    }
+  }
+  reader_t r{"/tmp/cslibs_utility_test_stream.csv", true, CSVReadMode::Mapped};
+  ASSERT_EQ(r.getData().size(), rows);
+
+  /// a tiny buffer forces refills and lines longer than the buffer
+  stream_reader_t batched{"/tmp/cslibs_utility_test_stream.csv", true, 64};
+  ASSERT_TRUE(batched.hasHeader());
+  EXPECT_EQ(batched.getHeader(), r.getHeader());
+  stream_reader_t::data_t data;
+  std::size_t batches = 0;
+  while (batched.nextBatch(64, data) > 0) {
+    ++batches;
+  }
+  EXPECT_EQ(batches, (rows + 63) / 64);
+  EXPECT_EQ(data, r.getData());
+
+  stream_reader_t iterated{"/tmp/cslibs_utility_test_stream.csv", true};
+  std::size_t s = 0;
+  for (const auto &entry : iterated) {
+    ASSERT_LT(s, rows);
+    EXPECT_EQ(entry, r.getData()[s]);
+    ++s;
+  }
+  EXPECT_EQ(s, rows);
+}
+
+TEST(Test_cslibs_utility, csvWriterBatches) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, int>;
+  using reader_t = cslibs_utility::logger::CSVReader<int, int>;
+
+  const int producers = 4;
+  const int rows = 1000;
+  {
+    writer_t::options_t options;
+    options.batch_size = 16;
+    options.flush_interval = std::chrono::milliseconds(1);
+    writer_t w{{"producer", "row"}, "/tmp/cslibs_utility_test_batches.csv",
+               options};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&w, p, rows]() {
+        for (int j = 0; j < rows; ++j) {
+          w.write(p, j);
+        }
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+  }
+
+  reader_t r{"/tmp/cslibs_utility_test_batches.csv", true};
+  ASSERT_EQ(r.getData().size(), static_cast<std::size_t>(producers * rows));
+
+  std::vector<int> next(producers, 0);
+  for (const auto &entry : r.getData()) {
+    const int p = std::get<0>(entry);
+    EXPECT_EQ(std::get<1>(entry), next[p]++);
+  }
+}
+
+TEST(Test_cslibs_utility, csvWriterRingBackend) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, int>;
+  using reader_t = cslibs_utility::logger::CSVReader<int, int>;
+  using cslibs_utility::logger::OverflowPolicy;
+
+  const int producers = 4;
+  const int rows = 1000;
+  for (const auto policy : {OverflowPolicy::Block, OverflowPolicy::DropNewest,
+                            OverflowPolicy::DropOldest}) {
+    std::size_t dropped = 0;
+    {
+      writer_t::options_t options;
+      options.flush_interval = std::chrono::milliseconds(1);
+      options.ring_capacity = 64;
+      options.ring_slot_size = 32;
+      options.overflow_policy = policy;
+      writer_t w{"/tmp/cslibs_utility_test_ring.csv", options};
+
+      std::vector<std::thread> threads;
+      for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&w, p, rows, policy]() {
+          for (int j = 0; j < rows; ++j) {
+            const bool accepted = w.tryWrite(p, j);
+            EXPECT_TRUE(accepted || policy != OverflowPolicy::DropOldest);
+            if (!accepted && policy == OverflowPolicy::Block) {
+              w.write(p, j);
+            }
+          }
+        });
+      }
+      for (auto &t : threads) {
+        t.join();
+      }
+      dropped = w.dropped();
+    }
+
+    reader_t r{"/tmp/cslibs_utility_test_ring.csv"};
+    ASSERT_EQ(r.getData().size() + (policy == OverflowPolicy::Block ? 0 : dropped),
+              static_cast<std::size_t>(producers * rows));
+
+    std::vector<int> last(producers, -1);
+    for (const auto &entry : r.getData()) {
+      const int p = std::get<0>(entry);
+      EXPECT_GT(std::get<1>(entry), last[p]);
+      last[p] = std::get<1>(entry);
+    }
+  }
+}
+
+TEST(Test_cslibs_utility, csvWriterRotation) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, int>;
+  using reader_t = cslibs_utility::logger::CSVReader<int, int>;
+
+  const std::string path = "/tmp/cslibs_utility_test_rotation.csv";
+  std::size_t segments = 0;
+  {
+    writer_t::options_t options;
+    options.batch_size = 10;
+    options.flush_interval = std::chrono::milliseconds(1);
+    options.rotate_size = 64;
+    writer_t w{{"row", "value"}, path, options};
+    for (int j = 0; j < 1000; ++j) {
+      w.write(j, 2 * j);
+      if (j % 50 == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+    }
+  }
+  {
+    cslibs_utility::logger::AsyncWriter::Options options;
+    options.rotate_size = 64;
+    cslibs_utility::logger::AsyncWriter probe{"/tmp/cslibs_utility_test_probe.csv",
+                                              "", options};
+    EXPECT_EQ(probe.segmentPath(0), "/tmp/cslibs_utility_test_probe.csv");
+    EXPECT_EQ(probe.segmentPath(3), "/tmp/cslibs_utility_test_probe.3.csv");
+  }
+
+  /// every segment is a complete file with header, rows are not split
+  int next = 0;
+  for (;; ++segments) {
+    const std::string segment =
+        segments == 0 ? path
+                      : "/tmp/cslibs_utility_test_rotation." +
+                            std::to_string(segments) + ".csv";
+    if (!std::ifstream(segment).good()) break;
+    reader_t r{segment, true};
+    EXPECT_EQ(r.getHeader()[1], "value");
+    for (const auto &entry : r.getData()) {
+      EXPECT_EQ(std::get<0>(entry), next);
+      EXPECT_EQ(std::get<1>(entry), 2 * next);
+      ++next;
+    }
+    std::remove(segment.c_str());
+  }
+  EXPECT_EQ(next, 1000);
+  EXPECT_GT(segments, 1ul);
+
+  /// only the last segments are kept
+  {
+    writer_t::options_t options;
+    options.batch_size = 10;
+    options.flush_interval = std::chrono::milliseconds(1);
+    options.rotate_size = 64;
+    options.max_segments = 2;
+    writer_t w{{"row", "value"}, path, options};
+    for (int j = 0; j < 1000; ++j) {
+      w.write(j, 2 * j);
+      if (j % 50 == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+    }
+  }
+  EXPECT_FALSE(std::ifstream(path).good());
+}
+
+#ifdef CSLIBS_UTILITY_WITH_ZLIB
+TEST(Test_cslibs_utility, csvWriterGzip) {
+  using writer_t = cslibs_utility::logger::CSVWriter<int, std::string>;
+
+  const std::string path = "/tmp/cslibs_utility_test_gzip.csv";
+  std::string expected = "row,text\n";
+  {
+    writer_t::options_t options;
+    options.compression = cslibs_utility::logger::Compression::Gzip;
+    writer_t w{{"row", "text"}, path, options};
+    for (int j = 0; j < 10000; ++j) {
+      w.write(j, "compressed");
+      expected += std::to_string(j) + ",compressed\n";
+    }
+  }
+
+  gzFile in = gzopen((path + ".gz").c_str(), "rb");
+  ASSERT_NE(in, nullptr);
+  std::string content(expected.size() + 1, '\0');
+  const int read = gzread(in, &content[0], static_cast<unsigned>(content.size()));
+  gzclose(in);
+  content.resize(static_cast<std::size_t>(std::max(read, 0)));
+  EXPECT_EQ(content, expected);
+}
+#endif
+
+TEST(Test_cslibs_utility, rowRingBuffer) {
+  using cslibs_utility::logger::OverflowPolicy;
+  using cslibs_utility::logger::RowRingBuffer;
+
+  RowRingBuffer newest(3, 4, OverflowPolicy::DropNewest);
+  EXPECT_EQ(newest.capacity(), 4ul);
+  for (const char *row : {"a", "b", "c", "d", "e"}) {
+    newest.push(row, 1);
+  }
+  EXPECT_FALSE(newest.push("too long", 8));
+  EXPECT_EQ(newest.dropped(), 2ul);
+
+  std::string drained;
+  auto collect = [&drained](const char *data, std::size_t size) {
+    drained.append(data, size);
+  };
+  EXPECT_EQ(newest.drain(collect), 4ul);
+  EXPECT_EQ(drained, "abcd");
+
+  RowRingBuffer oldest(4, 4, OverflowPolicy::DropOldest);
+  for (const char *row : {"a", "b", "c", "d", "e", "f"}) {
+    EXPECT_TRUE(oldest.push(row, 1));
+  }
+  EXPECT_EQ(oldest.dropped(), 2ul);
+  drained.clear();
+  EXPECT_EQ(oldest.drain(collect), 4ul);
+  EXPECT_EQ(drained, "cdef");
+
+  // a blocked push gives up once the ring is closed
+  RowRingBuffer blocking(2, 4, OverflowPolicy::Block);
+  EXPECT_TRUE(blocking.push("a", 1));
+  EXPECT_TRUE(blocking.push("b", 1));
+  std::thread producer([&blocking]() { EXPECT_FALSE(blocking.push("c", 1)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  blocking.close();
+  producer.join();
+  EXPECT_FALSE(blocking.push("d", 1));
+  EXPECT_EQ(blocking.dropped(), 2ul);
+}
+
+TEST(Test_cslibs_utility, csvWriterRingBackendFailure) {
+  using cslibs_utility::logger::AsyncWriter;
+  using cslibs_utility::logger::OverflowPolicy;
+
+  // the worker fails to open the file, blocking producers must not hang
+  AsyncWriter::Options options;
+  options.ring_capacity = 4;
+  options.overflow_policy = OverflowPolicy::Block;
+  AsyncWriter writer{"/nonexistent/cslibs_utility_test.csv", "", options};
+  std::atomic<std::size_t> accepted(0);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 4; ++p) {
+    producers.emplace_back([&writer, &accepted]() {
+      for (int i = 0; i < 100; ++i) {
+        accepted += writer.append("row\n");
+      }
+    });
+  }
+  for (auto &p : producers) {
+    p.join();
+  }
+  // nothing is drained, so at most a full ring was accepted
+  EXPECT_LE(accepted.load(), writer.options().ring_capacity);
+}
+
+TEST(Test_cslibs_utility, csvFormatter) {
+  using formatter_t =
+      cslibs_utility::logger::CSVFormatter<int, double, bool, std::string>;
+
+  std::string buffer;
+  formatter_t::formatRow(buffer, -42, 0.5, true, "text");
+  formatter_t::format(buffer, 7, 1e-7, false, "");
+  EXPECT_EQ(buffer, "-42,0.5,1,text\n7,1e-07,0,");
+
+  const std::size_t capacity = buffer.capacity();
+  buffer.clear();
+  formatter_t::formatRow(buffer, 1, 2.0, false, "x");
+  EXPECT_EQ(buffer, "1,2,0,x\n");
+  EXPECT_EQ(buffer.capacity(), capacity);
+}
+
+namespace {
+struct Pose {
+  double time;
+  double x;
+  double y;
+  std::string frame;
+};
+CSLIBS_CSV_SCHEMA(Pose, time, x, y, frame)
+
+struct Position {
+  double y;
+  double x;
+};
+CSLIBS_CSV_SCHEMA(Position, y, x)
+}  // namespace
+
+TEST(Test_cslibs_utility, csvSchema) {
+  using namespace cslibs_utility::logger;
+  static_assert(csv_schema_size<Pose> == 4, "");
+  static_assert(csvColumnIndex<Pose>("y") == 2, "");
+  static_assert(csvColumnIndex<Pose>("z") == 4, "");
+  static_assert(std::is_same<csv_column_t<Pose, 3>, std::string>::value, "");
+
+  const std::string path = "/tmp/cslibs_utility_test_schema.csv";
+  EXPECT_EQ(CSVSchemaWriter<Pose>::header(), "time,x,y,frame\n");
+  {
+    CSVSchemaWriter<Pose> writer{path};
+    for (int i = 0; i < 100; ++i) {
+      writer.write(Pose{0.5 * i, 1.0 * i, -2.0 * i, "map"});
+    }
+  }
+
+  /// in order
+  CSVSchemaReader<Pose> poses{path};
+  ASSERT_EQ(poses.getData().size(), 100ul);
+  EXPECT_EQ(poses.getHeader(),
+            (std::vector<std::string>{"time", "x", "y", "frame"}));
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(poses.getData()[i].time, 0.5 * i);
+    EXPECT_EQ(poses.getData()[i].y, -2.0 * i);
+    EXPECT_EQ(poses.getData()[i].frame, "map");
+  }
+
+  cslibs_utility::concurrency::thread_pool pool(2);
+  CSVSchemaReader<Pose> pooled{path, true, pool};
+  ASSERT_EQ(pooled.getData().size(), 100ul);
+  EXPECT_EQ(pooled.getData()[99].x, 99.0);
+
+  /// reordered projection, time and frame are skipped
+  CSVSchemaReader<Position> positions{path};
+  ASSERT_EQ(positions.getData().size(), 100ul);
+  EXPECT_TRUE(positions.hasColumn(0) && positions.hasColumn(1));
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(positions.getData()[i].x, 1.0 * i);
+    EXPECT_EQ(positions.getData()[i].y, -2.0 * i);
+  }
+
+  /// missing and surplus columns
+  {
+    std::ofstream out{path};
+    out << "frame,extra,x,time\nodom,1,2.5,3\nbase,2,x,4\n";
+  }
+  CSVSchemaReader<Pose> partial{path};
+  EXPECT_FALSE(partial.hasColumn(2));
+  ASSERT_EQ(partial.getData().size(), 1ul);
+  EXPECT_EQ(partial.getData()[0].frame, "odom");
+  EXPECT_EQ(partial.getData()[0].x, 2.5);
+  EXPECT_EQ(partial.getData()[0].time, 3.0);
+  EXPECT_EQ(partial.getData()[0].y, 0.0);
+}
+
+TEST(Test_cslibs_utility, csvLoggerClocks) {
+  using namespace cslibs_utility::logger;
+  using steady_t = SteadyClock<std::chrono::nanoseconds>;
+  using tsc_t = TSCClock<std::chrono::nanoseconds>;
+
+  const std::int64_t s0 = steady_t::now();
+  const std::int64_t t0 = tsc_t::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  const std::int64_t t1 = tsc_t::now();
+  const std::int64_t s1 = steady_t::now();
+  EXPECT_GE(t0, s0 - 1000000);
+  EXPECT_LE(t1, s1 + 1000000);
+  EXPECT_GE(t1 - t0, 19000000);
+
+  const std::string path = "/tmp/cslibs_utility_test_logger.csv";
+  {
+    BasicCSVLogger<steady_t, int> logger{{"value"}, path};
+    logger.logAt(42, 1);
+    logger.log(2);
+    EXPECT_TRUE(logger.tryLogAt(43, 3));
+  }
+  CSVReader<std::int64_t, int> reader{path, true, CSVReadMode::Mapped};
+  EXPECT_EQ(reader.getHeader()[0], "time");
+  ASSERT_EQ(reader.getData().size(), 3ul);
+  EXPECT_EQ(std::get<0>(reader.getData()[0]), 42);
+  EXPECT_GE(std::get<0>(reader.getData()[1]), s1);
+  EXPECT_EQ(std::get<0>(reader.getData()[2]), 43);
+  EXPECT_EQ(std::get<1>(reader.getData()[2]), 3);
+}
+
+TEST(Test_cslibs_utility, csvMergeReader) {
+  using namespace cslibs_utility::logger;
+  using logger_t = CSVLogger<int>;
+
+  const std::vector<std::string> paths = {
+      "/tmp/cslibs_utility_test_merge_0.csv",
+      "/tmp/cslibs_utility_test_merge_1.csv",
+      "/tmp/cslibs_utility_test_merge_2.csv",
+      "/tmp/cslibs_utility_test_merge_empty.csv"};
+  {
+    logger_t l0{{"value"}, paths[0]};
+    logger_t l1{{"value"}, paths[1]};
+    logger_t l2{{"value"}, paths[2]};
+    logger_t empty{{"value"}, paths[3]};
+    for (int i = 0; i < 300; ++i) {
+      l0.logAt(3 * i, 0);
+      l1.logAt(3 * i + 1, 1);
+      /// every second row of file 2 shares its stamp with file 0
+      l2.logAt(i % 2 == 0 ? 3 * i : 3 * i + 2, 2);
+    }
+  }
+
+  /// a tiny buffer forces refills of all files
+  CSVMergeReader<int> merged{paths, true, 64};
+  EXPECT_EQ(merged.sources(), 4ul);
+  EXPECT_EQ(merged.getReader(1).getHeader()[0], "time");
+
+  std::size_t rows = 0;
+  std::int64_t last = -1;
+  std::size_t last_source = 0;
+  std::vector<std::size_t> per_source(merged.sources(), 0);
+  for (auto it = merged.begin(); it != merged.end(); ++it) {
+    const std::int64_t stamp = std::get<0>(*it);
+    ASSERT_GE(stamp, last);
+    if (stamp == last) {
+      EXPECT_LT(last_source, it.source());
+    }
+    EXPECT_EQ(std::get<1>(*it), static_cast<int>(it.source()));
+    ++per_source[it.source()];
+    last = stamp;
+    last_source = it.source();
+    ++rows;
+  }
+  EXPECT_EQ(rows, 900ul);
+  EXPECT_EQ(per_source, (std::vector<std::size_t>{300, 300, 300, 0}));
+
+  CSVMergeReader<int>::entry_t entry;
+  EXPECT_FALSE(merged.next(entry));
+  CSVMergeReader<int> missing{{"/tmp/cslibs_utility_test_merge_missing.csv"}};
+  EXPECT_FALSE(missing.next(entry));
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
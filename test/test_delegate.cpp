@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <unordered_set>
+
+#include <cslibs_utility/common/delegate.hpp>
+#include <cslibs_utility/common/unique_delegate.hpp>
+
+using cslibs_utility::common::delegate;
+using cslibs_utility::common::unique_delegate;
+
+namespace {
+int twice(int i) { return 2 * i; }
+
+struct Counter {
+  int count = 0;
+  int add(int i) { return count += i; }
+  int get(int i) const { return count + i; }
+};
+}  // namespace
+
+TEST(Test_cslibs_utility, delegateInlineAndHeapStorage) {
+  int offset = 3;
+  delegate<int(int)> small([&offset](int i) { return i + offset; });
+  EXPECT_EQ(small(1), 4);
+
+  std::array<int, 64> table;
+  table.fill(7);
+  delegate<int(int)> large([table](int i) { return table[i] + i; });
+  EXPECT_EQ(large(1), 8);
+
+  // copies of inline functors are independent of the original
+  delegate<int(int)> copy(small);
+  small.reset();
+  EXPECT_EQ(copy(1), 4);
+  offset = 5;
+  EXPECT_EQ(copy(1), 6);
+
+  delegate<int(int)> moved(std::move(copy));
+  EXPECT_EQ(moved(1), 6);
+  delegate<int(int)> large_copy(large);
+  EXPECT_EQ(large_copy(2), 9);
+
+  // reassignment switches between inline and heap storage
+  moved = large;
+  EXPECT_EQ(moved(1), 8);
+  moved = [](int i) { return -i; };
+  EXPECT_EQ(moved(1), -1);
+  EXPECT_EQ(large(1), 8);
+}
+
+TEST(Test_cslibs_utility, delegateComparison) {
+  Counter counter;
+  auto f = delegate<int(int)>::from<Counter, &Counter::add>(&counter);
+  auto g = delegate<int(int)>::from<Counter, &Counter::add>(counter);
+  EXPECT_TRUE(f == g);
+  EXPECT_EQ(f(2), 2);
+
+  int offset = 1;
+  delegate<int(int)> a([&offset](int i) { return i + offset; });
+  delegate<int(int)> b(a);
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a < b || b < a);
+  EXPECT_FALSE(a == f);
+
+  std::unordered_set<delegate<int(int)>> set;
+  set.insert(a);
+  set.insert(b);
+  set.insert(f);
+  set.insert(g);
+  EXPECT_EQ(set.size(), 2ul);
+
+  delegate<int(int)> h(twice);
+  EXPECT_EQ(h(4), 8);
+}
+
+TEST(Test_cslibs_utility, uniqueDelegate) {
+  auto value = std::make_unique<int>(4);
+  unique_delegate<int(int)> d([v = std::move(value)](int i) { return *v + i; });
+  EXPECT_TRUE(static_cast<bool>(d));
+  EXPECT_EQ(d(1), 5);
+
+  unique_delegate<int(int)> moved(std::move(d));
+  EXPECT_TRUE(d == nullptr);
+  EXPECT_EQ(moved(2), 6);
+
+  std::array<int, 64> table;
+  table.fill(1);
+  unique_delegate<int(int)> large([table](int i) { return table[i] + i; });
+  moved.swap(large);
+  EXPECT_EQ(moved(1), 2);
+  EXPECT_EQ(large(1), 5);
+
+  Counter counter;
+  unique_delegate<int(int)> method(&counter, &Counter::add);
+  EXPECT_EQ(method(3), 3);
+  auto const_method =
+      unique_delegate<int(int)>::from<Counter, &Counter::get>(counter);
+  EXPECT_EQ(const_method(1), 4);
+
+  unique_delegate<int(int)> function(twice);
+  EXPECT_EQ(function(3), 6);
+  function = nullptr;
+  EXPECT_FALSE(static_cast<bool>(function));
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
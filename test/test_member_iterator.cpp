@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <cslibs_utility/iterators/feedback_member_iterator.hpp>
+#include <cslibs_utility/iterators/member_iterator.hpp>
+#include <cslibs_utility/iterators/member_view.hpp>
+#include <cslibs_utility/iterators/parallel_feedback_member_decorator.hpp>
+
+namespace ci = cslibs_utility::iterators;
+
+namespace {
+struct Particle {
+  double x;
+  double weight;
+};
+using particles_t = std::vector<Particle>;
+using decorator_t =
+    ci::MemberDecorator<Particle, particles_t, double, &Particle::weight>;
+using view_t = ci::MemberView<Particle, double, &Particle::weight>;
+
+particles_t makeParticles(const std::size_t n) {
+  particles_t particles(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    particles[i].x = -1.0;
+    particles[i].weight = static_cast<double>(i);
+  }
+  return particles;
+}
+}  // namespace
+
+TEST(Test_cslibs_utility, memberIteratorRandomAccess) {
+  particles_t particles = makeParticles(8);
+  decorator_t decorator(particles);
+  auto begin = decorator.begin();
+  auto end = decorator.end();
+
+  EXPECT_EQ(end - begin, 8);
+  EXPECT_EQ(begin[3], 3.0);
+  EXPECT_EQ(*(begin + 5), 5.0);
+  EXPECT_EQ(*(2 + begin), 2.0);
+  EXPECT_EQ(*(end - 1), 7.0);
+  EXPECT_TRUE(begin < end);
+  EXPECT_EQ(std::accumulate(begin, end, 0.0), 28.0);
+
+  auto it = begin;
+  it += 4;
+  EXPECT_EQ((it++).getData().weight, 4.0);
+  EXPECT_EQ(*it, 5.0);
+  EXPECT_EQ(*--it, 4.0);
+
+  // only the weights are reordered, the rest of each entry stays in place
+  std::sort(begin, end, std::greater<double>());
+  EXPECT_EQ(particles.front().weight, 7.0);
+  EXPECT_EQ(*std::max_element(begin, end), 7.0);
+  EXPECT_EQ(particles.front().x, -1.0);
+
+  particles_t empty;
+  decorator_t empty_decorator(empty);
+  EXPECT_TRUE(empty_decorator.begin() == empty_decorator.end());
+}
+
+TEST(Test_cslibs_utility, memberView) {
+  particles_t particles = makeParticles(1001);
+  view_t view(particles);
+  EXPECT_EQ(view.size(), 1001ul);
+  EXPECT_EQ(view[10], 10.0);
+  EXPECT_EQ(view.reduce(0.0, std::plus<double>()), 500500.0);
+  EXPECT_EQ(view.reduce(0.0, std::plus<double>(), 4), 500500.0);
+  EXPECT_EQ(view.reduce(0.0, [](double a, double b) { return std::max(a, b); }, 3),
+            1000.0);
+
+  view.transform([](double w) { return 2.0 * w; }, 4);
+  EXPECT_EQ(particles[1000].weight, 2000.0);
+  EXPECT_EQ(particles[1000].x, -1.0);
+
+  std::vector<double> weights(view.size());
+  view.gather(weights.data());
+  EXPECT_EQ(weights[7], 14.0);
+  std::fill(weights.begin(), weights.end(), 1.0);
+  view.scatter(weights.data());
+  EXPECT_EQ(view.reduce(0.0, std::plus<double>(), 2), 1001.0);
+
+  particles_t empty;
+  EXPECT_EQ(view_t(empty).reduce(1.0, std::plus<double>(), 4), 1.0);
+}
+
+TEST(Test_cslibs_utility, memberViewThreadPool) {
+  cslibs_utility::concurrency::thread_pool pool(3);
+  particles_t particles = makeParticles(1001);
+  view_t view(particles);
+  EXPECT_EQ(view.reduce(0.0, std::plus<double>(), pool), 500500.0);
+
+  view.transform([](double w) { return w + 1.0; }, pool);
+  EXPECT_EQ(particles[0].weight, 1.0);
+  EXPECT_EQ(particles[1000].weight, 1001.0);
+  EXPECT_EQ(view.reduce(0.0, [](double a, double b) { return std::max(a, b); }, pool),
+            1001.0);
+
+  particles_t empty;
+  EXPECT_EQ(view_t(empty).reduce(1.0, std::plus<double>(), pool), 1.0);
+}
+
+TEST(Test_cslibs_utility, feedbackMemberDecorator) {
+  particles_t particles = makeParticles(10);
+  double sum = 0.0;
+  int touched = 0, finished = 0;
+  {
+    ci::FeedbackMemberDecorator<Particle, particles_t, double, &Particle::weight>
+        decorator(particles, [&touched]() { ++touched; },
+                  [&sum](const double &w) { sum += w; },
+                  [&finished]() { ++finished; });
+    for (auto &w : decorator) {
+      w *= 2.0;
+    }
+  }
+  EXPECT_EQ(touched, 1);
+  EXPECT_EQ(finished, 1);
+  EXPECT_EQ(sum, 90.0);
+}
+
+TEST(Test_cslibs_utility, batchedFeedbackMemberDecorator) {
+  particles_t particles = makeParticles(1000);
+  double sum = 0.0;
+  std::vector<std::size_t> batches;
+  bool flushed_before_finished = false;
+  {
+    ci::BatchedFeedbackMemberDecorator<Particle, particles_t, double,
+                                       &Particle::weight, 256>
+        decorator(particles, []() {},
+                  [&](const double *w, std::size_t n) {
+                    batches.push_back(n);
+                    sum = std::accumulate(w, w + n, sum);
+                  },
+                  [&]() { flushed_before_finished = sum == 999000.0; });
+    for (auto &w : decorator) {
+      w *= 2.0;
+    }
+  }
+  EXPECT_EQ(batches, (std::vector<std::size_t>{256, 256, 256, 232}));
+  EXPECT_TRUE(flushed_before_finished);
+  EXPECT_EQ(particles[999].weight, 1998.0);
+}
+
+namespace {
+struct WeightStatistics {
+  double sum = 0.0;
+  double max = 0.0;
+  std::size_t count = 0;
+
+  void update(const double &w) {
+    sum += w;
+    max = std::max(max, w);
+    ++count;
+  }
+
+  void merge(const WeightStatistics &other) {
+    sum += other.sum;
+    max = std::max(max, other.max);
+    count += other.count;
+  }
+};
+}  // namespace
+
+TEST(Test_cslibs_utility, parallelFeedbackMemberDecorator) {
+  particles_t particles = makeParticles(1001);
+  WeightStatistics result;
+  {
+    ci::ParallelFeedbackMemberDecorator<Particle, particles_t, double,
+                                        &Particle::weight, WeightStatistics>
+        decorator(particles, 4,
+                  [&result](const WeightStatistics &s) { result = s; });
+    decorator.forEach([](double &w) { w *= 0.5; });
+    EXPECT_EQ(decorator.getResult().count, 1001ul);
+    EXPECT_EQ(result.count, 0ul);
+  }
+  EXPECT_EQ(result.count, 1001ul);
+  EXPECT_EQ(result.sum, 250250.0);
+  EXPECT_EQ(result.max, 500.0);
+  EXPECT_EQ(particles[1000].weight, 500.0);
+
+  cslibs_utility::concurrency::thread_pool pool(3);
+  {
+    ci::ParallelFeedbackMemberDecorator<Particle, particles_t, double,
+                                        &Particle::weight, WeightStatistics>
+        decorator(particles, pool,
+                  [&result](const WeightStatistics &s) { result = s; });
+    decorator.forEach([](double &w) { w *= 2.0; });
+  }
+  EXPECT_EQ(result.count, 1001ul);
+  EXPECT_EQ(result.sum, 500500.0);
+  EXPECT_EQ(result.max, 1000.0);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/buffered/buffered_vector.hpp>
+#include <cslibs_utility/memory/arena_allocator.hpp>
+#include <cslibs_utility/memory/pool_allocator.hpp>
+#include <cslibs_utility/synchronized/synchronized_priority_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_queue.hpp>
+
+namespace cm = cslibs_utility::memory;
+
+TEST(Test_cslibs_utility, monotonicArena) {
+  cm::monotonic_arena arena(256);
+  std::vector<int, cm::monotonic_allocator<int>> v{
+      cm::monotonic_allocator<int>(arena)};
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v[999], 999);
+  EXPECT_GE(arena.allocated(), 1000 * sizeof(int));
+
+  void *p = arena.allocate(3, 1);
+  void *q = arena.allocate(8, 64);
+  EXPECT_NE(p, q);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(q) % 64, 0u);
+
+  v.clear();
+  v.shrink_to_fit();
+  arena.reset();
+  EXPECT_EQ(arena.allocated(), 0ul);
+}
+
+TEST(Test_cslibs_utility, frameArena) {
+  cm::frame_arena frame(1 << 12);
+  using allocator_t = cm::frame_allocator<float>;
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    cslibs_utility::buffered::buffered_vector<float, allocator_t> v(
+        0, 256, allocator_t(frame));
+    v.push_back(1.f);
+    EXPECT_EQ(frame.used(), 256 * sizeof(float));
+    frame.reset();
+  }
+  EXPECT_EQ(frame.high_water_mark(), 256 * sizeof(float));
+  EXPECT_THROW(frame.allocate(1 << 13, 8), std::bad_alloc);
+  EXPECT_TRUE(allocator_t(frame) == cm::frame_allocator<int>(frame));
+}
+
+TEST(Test_cslibs_utility, poolAllocator) {
+  std::list<int, cm::pool_allocator<int>> l;
+  std::map<int, int, std::less<int>,
+           cm::pool_allocator<std::pair<const int, int>>> m;
+  for (int i = 0; i < 10000; ++i) {
+    l.push_back(i);
+    m[i] = i;
+  }
+  EXPECT_EQ(l.back(), 9999);
+  EXPECT_EQ(m.size(), 10000ul);
+
+  // blocks freed by one thread are reused by another one later on
+  std::thread t([&l]() { l.clear(); });
+  t.join();
+  l.push_back(1);
+  EXPECT_EQ(l.size(), 1ul);
+
+  cslibs_utility::synchronized::priority_queue<int, std::less<int>,
+                                               cm::pool_allocator<char>> q;
+  auto h = q.emplace(1);
+  q.emplace(2);
+  q.update(h, 3);
+  EXPECT_EQ(q.pop(), 3);
+  EXPECT_EQ(q.pop(), 2);
+}
+
+TEST(Test_cslibs_utility, poolAllocatorProducerConsumer) {
+  // a size class of its own, so that no other test shares its chunks
+  using pool_t = cm::fixed_pool<200, 8>;
+  const std::size_t rounds = 100 * pool_t::chunk_blocks;
+  cslibs_utility::synchronized::queue<void*> q;
+
+  // blocks allocated here and freed there flow back to the producer
+  std::thread consumer([&q, rounds]() {
+    for (std::size_t i = 0; i < rounds; ++i) pool_t::local().deallocate(q.wait_pop());
+  });
+  for (std::size_t i = 0; i < rounds; ++i) {
+    while (q.size() > 1000) std::this_thread::yield();
+    q.push(pool_t::local().allocate());
+  }
+  consumer.join();
+  EXPECT_LE(pool_t::chunks(), 16ul);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/logger/csv_writer.hpp>
+#include <cslibs_utility/metrics/metrics.hpp>
+#include <cslibs_utility/signals/signals.hpp>
+#include <cslibs_utility/synchronized/synchronized_priority_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_queue.hpp>
+
+namespace cm = cslibs_utility::metrics;
+
+static_assert(cm::enabled, "the test target defines CSLIBS_UTILITY_ENABLE_METRICS");
+
+TEST(Test_cslibs_utility, metricsRegistry) {
+  static const cm::Counter counter("test.counter");
+  static const cm::HighWater high_water("test.high_water");
+  static const cm::Histogram histogram("test.histogram");
+
+  const cm::Snapshot before = cm::snapshot();
+  counter.record(5);
+  high_water.record(3);
+  histogram.record(0);
+
+  /// exited threads are accumulated as well
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t]() {
+      for (std::uint64_t i = 1; i <= 1000; ++i) {
+        counter.record(1);
+        histogram.record(i);
+      }
+      high_water.record(10 + t);
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  const cm::Snapshot after = cm::snapshot();
+  const cm::Sample *c = after.find("test.counter");
+  const cm::Sample *w = after.find("test.high_water");
+  const cm::Sample *h = after.find("test.histogram");
+  ASSERT_TRUE(c && w && h);
+  EXPECT_EQ(c->kind, cm::Kind::Counter);
+  EXPECT_EQ(c->count - (before.find("test.counter") ? before.find("test.counter")->count : 0),
+            4005ul);
+  EXPECT_EQ(w->max, 13ul);
+  EXPECT_EQ(h->count, 4001ul);
+  EXPECT_EQ(h->sum, 4u * 500500u);
+  EXPECT_EQ(h->max, 1000ul);
+  EXPECT_EQ(h->buckets[0], 1ul);
+  EXPECT_EQ(h->buckets[1], 4ul);
+  EXPECT_EQ(h->buckets[10], 4u * 489u);
+  EXPECT_EQ(h->quantile(0.0), 0ul);
+  EXPECT_EQ(h->quantile(1.0), 1000ul);
+  EXPECT_EQ(h->quantile(0.5), 511ul);
+  EXPECT_GT(after.rate(before, "test.counter"), 0.0);
+  EXPECT_EQ(after.find("test.unknown"), nullptr);
+}
+
+TEST(Test_cslibs_utility, metricsHooks) {
+  cslibs_utility::synchronized::queue<int> q;
+  for (int i = 0; i < 100; ++i) {
+    q.push(i);
+  }
+  while (q.hasElements()) {
+    q.pop();
+  }
+
+  // named instances record into metrics of their own
+  cslibs_utility::synchronized::queue<int> named("test.queue");
+  named.push(1);
+  named.push(2);
+  named.push(3);
+
+  cslibs_utility::synchronized::priority_queue<int> pq;
+  pq.emplace(1);
+  pq.emplace(2);
+
+  cslibs_utility::signals::Signal<std::function<void(int)>> s("test.signal");
+  auto fast = s.connect([](int) {}, "fast");
+  auto slow = s.connect([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+  s.enable();
+  s(1);
+  s(2);
+
+  // connecting unnamed slots registers no metrics
+  const std::size_t registered = cm::snapshot().samples.size();
+  for (int i = 0; i < 2 * static_cast<int>(cm::max_metrics); ++i) {
+    auto c = s.connect([](int) {});
+    s.disconnect(c);
+  }
+  EXPECT_EQ(cm::snapshot().samples.size(), registered);
+
+  {
+    cslibs_utility::logger::CSVWriter<int> w{"/tmp/cslibs_utility_test_metrics.csv"};
+    for (int i = 0; i < 10; ++i) {
+      w.write(i);
+    }
+  }
+
+  const cm::Snapshot snapshot = cm::snapshot();
+  const cm::Sample *wait = snapshot.find("synchronized.queue.lock_wait_ns");
+  const cm::Sample *hold = snapshot.find("synchronized.queue.lock_hold_ns");
+  ASSERT_TRUE(wait && hold);
+  EXPECT_GE(wait->count, 200ul);
+  EXPECT_EQ(wait->kind, cm::Kind::Histogram);
+  EXPECT_EQ(hold->count, wait->count);
+  ASSERT_TRUE(snapshot.find("synchronized.queue.depth"));
+  EXPECT_EQ(snapshot.find("synchronized.queue.depth")->max, 100ul);
+  ASSERT_TRUE(snapshot.find("synchronized.priority_queue.depth"));
+  EXPECT_EQ(snapshot.find("synchronized.priority_queue.depth")->max, 2ul);
+  ASSERT_TRUE(snapshot.find("test.queue.depth"));
+  EXPECT_EQ(snapshot.find("test.queue.depth")->max, 3ul);
+  ASSERT_TRUE(snapshot.find("test.queue.lock_wait_ns"));
+  EXPECT_EQ(snapshot.find("test.queue.lock_wait_ns")->count, 3ul);
+  ASSERT_TRUE(snapshot.find("synchronized.priority_queue.lock_wait_ns"));
+  const cm::Sample *fast_ns = snapshot.find("test.signal.fast.slot_ns");
+  const cm::Sample *slow_ns = snapshot.find("test.signal.slot_ns");
+  ASSERT_TRUE(fast_ns && slow_ns);
+  EXPECT_EQ(fast_ns->count, 2ul);
+  EXPECT_EQ(slow_ns->count, 2ul);
+  EXPECT_GE(slow_ns->max, 1000000ul);
+  EXPECT_LT(fast_ns->max, slow_ns->max);
+  ASSERT_TRUE(snapshot.find("logger.writer.rows"));
+  EXPECT_EQ(snapshot.find("logger.writer.rows")->count, 10ul);
+  ASSERT_TRUE(snapshot.find("logger.writer.backlog_bytes"));
+  EXPECT_LE(snapshot.find("logger.writer.backlog_bytes")->max, 20ul);
+}
+
+TEST(Test_cslibs_utility, metricsRegistryFull) {
+  // runs last, the registry stays full
+  for (std::size_t i = cm::snapshot().samples.size(); i < cm::max_metrics; ++i) {
+    const cm::Counter fill("test.fill." + std::to_string(i));
+  }
+  testing::internal::CaptureStderr();
+  const cm::Counter overflow("test.overflow");
+  EXPECT_NE(testing::internal::GetCapturedStderr().find("test.overflow"), std::string::npos);
+  overflow.record(1);
+  const cm::Snapshot snapshot = cm::snapshot();
+  EXPECT_EQ(snapshot.samples.size(), cm::max_metrics);
+  EXPECT_EQ(snapshot.find("test.overflow"), nullptr);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
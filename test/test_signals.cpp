@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include <cslibs_utility/signals/async_signal.hpp>
+#include <cslibs_utility/signals/signals.hpp>
+
+using signal_t = cslibs_utility::signals::Signal<std::function<void(int)>>;
+
+TEST(Test_cslibs_utility, signalConnectDisconnect) {
+  signal_t s;
+  int sum_a = 0;
+  int sum_b = 0;
+  auto a = s.connect([&sum_a](int i) { sum_a += i; });
+  auto b = s.connect([&sum_b](int i) { sum_b += 2 * i; });
+  EXPECT_EQ(s.size(), 2ul);
+
+  s(1);
+  EXPECT_EQ(sum_a, 0);
+
+  s.enable();
+  s(1);
+  EXPECT_EQ(sum_a, 1);
+  EXPECT_EQ(sum_b, 2);
+
+  s.disconnect(a);
+  s(1);
+  EXPECT_EQ(sum_a, 1);
+  EXPECT_EQ(sum_b, 4);
+
+  b.reset();
+  EXPECT_EQ(s.size(), 0ul);
+  s(1);
+  EXPECT_EQ(sum_b, 4);
+}
+
+TEST(Test_cslibs_utility, signalConcurrentEmission) {
+  signal_t s;
+  s.enable();
+  std::atomic<long> calls(0);
+  auto c = s.connect([&calls](int) { ++calls; });
+
+  std::atomic_bool stop(false);
+  std::vector<std::thread> emitters;
+  for (int e = 0; e < 4; ++e) {
+    emitters.emplace_back([&s, &stop]() {
+      while (!stop) {
+        s(1);
+      }
+    });
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    std::atomic<int> value(0);
+    auto tmp = s.connect([&value](int v) { value = v; });
+    tmp.reset();
+  }
+  while (calls == 0) {
+    std::this_thread::yield();
+  }
+  stop = true;
+  for (auto &e : emitters) {
+    e.join();
+  }
+  EXPECT_EQ(s.size(), 1ul);
+}
+
+TEST(Test_cslibs_utility, signalDisconnectWaits) {
+  signal_t s;
+  s.enable();
+  std::atomic_bool entered(false);
+  std::atomic_bool finished(false);
+  auto slow = s.connect([&entered, &finished](int) {
+    entered = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    finished = true;
+  });
+  std::thread emitter([&s]() { s(1); });
+  while (!entered) {
+    std::this_thread::yield();
+  }
+  // returns once the invocation holding the slot is done
+  s.disconnect(slow);
+  EXPECT_TRUE(finished);
+  EXPECT_EQ(s.size(), 0ul);
+  emitter.join();
+}
+
+TEST(Test_cslibs_utility, signalDisconnectWithinSlot) {
+  signal_t s;
+  s.enable();
+  int calls = 0;
+  signal_t::Connection::Ptr other = s.connect([&calls](int) { ++calls; });
+  signal_t::Connection::Ptr self;
+  self = s.connect([&s, &self, &other](int) {
+    s.disconnect(other);
+    s.disconnect(self);
+  });
+  s(1);
+  EXPECT_EQ(s.size(), 0ul);
+  s(1);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(Test_cslibs_utility, asyncSignal) {
+  using async_signal_t =
+      cslibs_utility::signals::AsyncSignal<std::function<void(int)>>;
+  using cslibs_utility::signals::AsyncPolicy;
+
+  async_signal_t s(1024, AsyncPolicy::DropNewest, 2);
+  std::atomic<long> sum(0);
+  auto c = s.connect([&sum](int i) { sum += i; });
+
+  EXPECT_FALSE(s(1));
+  s.enable();
+  for (int i = 1; i <= 100; ++i) {
+    EXPECT_TRUE(s(i));
+  }
+  s.flush();
+  EXPECT_EQ(sum.load(), 5050);
+  EXPECT_EQ(s.getDropped(), 0ul);
+}
+
+TEST(Test_cslibs_utility, asyncSignalThreadPool) {
+  using async_signal_t =
+      cslibs_utility::signals::AsyncSignal<std::function<void(int)>>;
+  using cslibs_utility::signals::AsyncPolicy;
+
+  cslibs_utility::concurrency::thread_pool pool(2);
+  std::atomic<long> sum(0);
+  {
+    async_signal_t s(pool, 1024, AsyncPolicy::DropNewest, 2);
+    auto c = s.connect([&sum](int i) { sum += i; });
+    s.enable();
+    for (int i = 1; i <= 100; ++i) {
+      EXPECT_TRUE(s(i));
+    }
+    s.flush();
+    EXPECT_EQ(sum.load(), 5050);
+    EXPECT_EQ(s.getDropped(), 0ul);
+
+    for (int i = 1; i <= 100; ++i) {
+      EXPECT_TRUE(s(i));
+    }
+    s.flush();
+    EXPECT_EQ(sum.load(), 10100);
+
+    /// the destructor waits for the drain tasks still running
+    for (int i = 1; i <= 100; ++i) {
+      s(i);
+    }
+  }
+  EXPECT_GE(sum.load(), 10100);
+}
+
+TEST(Test_cslibs_utility, asyncSignalOverflow) {
+  using async_signal_t =
+      cslibs_utility::signals::AsyncSignal<std::function<void(int)>>;
+  using cslibs_utility::signals::AsyncPolicy;
+
+  for (const auto policy :
+       {AsyncPolicy::DropNewest, AsyncPolicy::DropOldest, AsyncPolicy::Coalesce}) {
+    async_signal_t s(4, policy);
+    s.enable();
+
+    std::mutex block;
+    std::atomic_bool entered(false);
+    std::vector<int> received;
+    auto c = s.connect([&block, &entered, &received](int i) {
+      entered = true;
+      std::unique_lock<std::mutex> l(block);
+      received.push_back(i);
+    });
+
+    std::unique_lock<std::mutex> l(block);
+    EXPECT_TRUE(s(0));
+    /// wait until the worker is stuck in the first slot invocation
+    while (!entered) {
+      std::this_thread::yield();
+    }
+    for (int i = 1; i <= 10; ++i) {
+      s(i);
+    }
+    l.unlock();
+    s.flush();
+
+    const std::vector<int> tail(received.begin() + 1, received.end());
+    if (policy == AsyncPolicy::DropNewest) {
+      EXPECT_EQ(tail, (std::vector<int>{1, 2, 3, 4}));
+    } else if (policy == AsyncPolicy::DropOldest) {
+      EXPECT_EQ(tail, (std::vector<int>{7, 8, 9, 10}));
+    } else {
+      EXPECT_EQ(tail, (std::vector<int>{10}));
+    }
+    EXPECT_GT(s.getDropped(), 0ul);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/synchronized/snapshot.hpp>
+#include <cslibs_utility/synchronized/triple_buffer.hpp>
+
+namespace cs = cslibs_utility::synchronized;
+
+namespace {
+/**
+ * @brief State which is only consistent if all entries are equal.
+ */
+using state_t = std::array<long, 64>;
+
+bool consistent(const state_t &s) {
+  for (const long v : s) {
+    if (v != s.front()) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+TEST(Test_cslibs_utility, tripleBuffer) {
+  cs::triple_buffer<int> b(0);
+  EXPECT_FALSE(b.update());
+  EXPECT_EQ(b.read(), 0);
+  b.write(1);
+  b.write(2);
+  EXPECT_EQ(b.read(), 2);
+  EXPECT_FALSE(b.update());
+
+  cs::triple_buffer<state_t> state;
+  std::atomic_bool ok(true);
+  const long count = 20000;
+  std::thread reader([&]() {
+    long last = 0;
+    while (last < count) {
+      const state_t &s = state.read();
+      if (!consistent(s) || s.front() < last) {
+        ok = false;
+      }
+      last = s.front();
+    }
+  });
+  for (long i = 1; i <= count; ++i) {
+    state.write_buffer().fill(i);
+    state.publish();
+  }
+  reader.join();
+  EXPECT_TRUE(ok);
+}
+
+TEST(Test_cslibs_utility, snapshot) {
+  cs::snapshot<state_t> state;
+  auto first = state.load();
+  EXPECT_EQ(first->front(), 0);
+
+  state_t s;
+  s.fill(1);
+  state.store(s);
+  EXPECT_EQ(first->front(), 0);
+  EXPECT_EQ(state.load()->front(), 1);
+
+  // the value replaced last is recycled once no reader holds it
+  first.reset();
+  s.fill(2);
+  state.store(s);
+  const state_t *recycled = state.load().get();
+  s.fill(3);
+  state.store(s);
+  s.fill(4);
+  state.store(s);
+  EXPECT_EQ(state.load().get(), recycled);
+
+  std::atomic_bool ok(true);
+  std::atomic_bool stop(false);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i) {
+    readers.emplace_back([&]() {
+      while (!stop) {
+        if (!consistent(*state.load())) {
+          ok = false;
+        }
+      }
+    });
+  }
+  for (long i = 0; i < 20000; ++i) {
+    auto p = state.acquire();
+    p->fill(i);
+    state.publish(std::move(p));
+  }
+  stop = true;
+  for (auto &r : readers) {
+    r.join();
+  }
+  EXPECT_TRUE(ok);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
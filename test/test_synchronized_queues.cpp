@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/synchronized/mpmc_queue.hpp>
+#include <cslibs_utility/synchronized/multi_queue.hpp>
+#include <cslibs_utility/synchronized/spsc_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_priority_queue.hpp>
+#include <cslibs_utility/synchronized/synchronized_queue.hpp>
+
+namespace cs = cslibs_utility::synchronized;
+
+TEST(Test_cslibs_utility, spscQueue) {
+  cs::spsc_queue<std::unique_ptr<int>, 4> q;
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(q.try_push(std::make_unique<int>(i)));
+  }
+  EXPECT_FALSE(q.try_emplace(std::make_unique<int>(4)));
+  EXPECT_EQ(q.size(), 4ul);
+
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(q.try_pop(value));
+  EXPECT_EQ(*value, 0);
+  EXPECT_EQ(*q.pop(), 1);
+  EXPECT_EQ(q.size(), 2ul);
+
+  const int count = 100000;
+  cs::spsc_queue<int, 64> p;
+  std::thread producer([&p]() {
+    for (int i = 0; i < count; ++i) {
+      p.push(i);
+    }
+  });
+  bool ordered = true;
+  for (int i = 0; i < count; ++i) {
+    ordered = ordered && p.pop() == i;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(p.empty());
+}
+
+TEST(Test_cslibs_utility, mpmcQueue) {
+  cs::mpmc_queue<int> q(3);
+  EXPECT_EQ(q.capacity(), 4ul);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(q.try_push(i));
+  }
+  EXPECT_FALSE(q.try_push(4));
+  int value = -1;
+  EXPECT_TRUE(q.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_EQ(q.pop(), 1);
+
+  const int producers = 4;
+  const int count = 20000;
+  cs::mpmc_queue<int> p(64);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < producers; ++t) {
+    threads.emplace_back([&p]() {
+      for (int i = 1; i <= count; ++i) {
+        p.push(i);
+      }
+    });
+  }
+  std::vector<long> sums(2, 0);
+  std::vector<std::thread> consumers;
+  for (auto &sum : sums) {
+    consumers.emplace_back([&p, &sum]() {
+      for (int i = 0; i < producers * count / 2; ++i) {
+        sum += p.pop();
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  for (auto &c : consumers) {
+    c.join();
+  }
+  EXPECT_EQ(sums[0] + sums[1], static_cast<long>(producers) * count * (count + 1) / 2);
+  EXPECT_TRUE(p.empty());
+}
+
+TEST(Test_cslibs_utility, synchronizedQueue) {
+  cs::queue<std::unique_ptr<int>> q;
+  std::unique_ptr<int> value;
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_FALSE(q.wait_pop(value, std::chrono::milliseconds(1)));
+
+  q.push(std::make_unique<int>(0));
+  q.emplace(new int(1));
+  EXPECT_TRUE(q.try_pop(value));
+  EXPECT_EQ(*value, 0);
+  EXPECT_EQ(*q.pop(), 1);
+
+  std::vector<std::unique_ptr<int>> batch;
+  for (int i = 0; i < 8; ++i) {
+    batch.emplace_back(std::make_unique<int>(i));
+  }
+  q.push_range(std::make_move_iterator(batch.begin()),
+               std::make_move_iterator(batch.end()));
+  EXPECT_EQ(q.size(), 8ul);
+  batch.clear();
+  EXPECT_EQ(q.pop_all(batch), 8ul);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(*batch.back(), 7);
+
+  std::thread producer([&q]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    q.emplace(new int(42));
+  });
+  EXPECT_EQ(*q.wait_pop(), 42);
+  producer.join();
+
+  cs::queue<std::string> s;
+  std::string top;
+  EXPECT_FALSE(s.try_top(top));
+  s.push("a");
+  s.push("b");
+  EXPECT_TRUE(s.try_top(top));
+  EXPECT_EQ(top, "a");
+  const std::string front = s.top();
+  s.pop();
+  EXPECT_EQ(front, "a");
+  EXPECT_EQ(s.top(), "b");
+}
+
+TEST(Test_cslibs_utility, multiQueue) {
+  // a single heap is a strict priority queue
+  cs::multi_queue<int> strict(1, 1);
+  std::vector<int> values{3, 1, 4, 1, 5, 9, 2, 6};
+  strict.push_range(values.begin(), values.end());
+  EXPECT_EQ(strict.size(), values.size());
+  std::sort(values.rbegin(), values.rend());
+  for (const int v : values) {
+    const auto top = strict.try_pop_top();
+    ASSERT_TRUE(top.has_value());
+    EXPECT_EQ(*top, v);
+  }
+  EXPECT_FALSE(strict.try_pop_top().has_value());
+
+  const int threads = 4;
+  const int count = 10000;
+  cs::multi_queue<int> relaxed(threads);
+  std::vector<std::thread> workers;
+  std::atomic<long> sum(0);
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&relaxed, &sum]() {
+      for (int i = 1; i <= count; ++i) {
+        relaxed.push(i);
+        sum += *relaxed.try_pop_top();
+      }
+    });
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+  EXPECT_TRUE(relaxed.empty());
+  EXPECT_EQ(sum.load(), static_cast<long>(threads) * count * (count + 1) / 2);
+}
+
+TEST(Test_cslibs_utility, priorityQueueHandles) {
+  // min-heap of (cost, node), as used by Dijkstra searches
+  using entry_t = std::pair<int, int>;
+  cs::priority_queue<entry_t, std::greater<entry_t>> q;
+  std::vector<cs::priority_queue<entry_t, std::greater<entry_t>>::handle_t> handles;
+  for (int node = 0; node < 4; ++node) {
+    handles.emplace_back(q.emplace(entry_t(10 + node, node)));
+  }
+
+  q.update(handles[3], entry_t(1, 3));
+  q.erase(handles[0]);
+  EXPECT_EQ(q.size(), 3ul);
+  EXPECT_EQ(q.top(), entry_t(1, 3));
+  EXPECT_EQ(q.pop(), entry_t(1, 3));
+
+  q.update(handles[2], entry_t(20, 2));
+  EXPECT_EQ(q.pop(), entry_t(11, 1));
+  EXPECT_EQ(q.pop(), entry_t(20, 2));
+  EXPECT_TRUE(q.empty());
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
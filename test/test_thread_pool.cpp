@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/concurrency/thread_pool.hpp>
+
+namespace cc = cslibs_utility::concurrency;
+
+TEST(Test_cslibs_utility, threadPoolSubmit) {
+  cc::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4ul);
+  EXPECT_FALSE(pool.is_worker());
+
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; ++i)
+    futures.emplace_back(pool.submit([](int a, int b) { return a * b; }, i, 2));
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(futures[i].get(), 2 * i);
+
+  std::future<bool> worker =
+      pool.submit([&pool]() { return pool.is_worker(); });
+  EXPECT_TRUE(worker.get());
+
+  std::future<void> error =
+      pool.submit([]() { throw std::runtime_error("task"); });
+  EXPECT_THROW(error.get(), std::runtime_error);
+
+  /// move-only arguments and results
+  std::future<std::unique_ptr<int>> moved = pool.submit(
+      [](std::unique_ptr<int> p) { return p; }, std::make_unique<int>(7));
+  EXPECT_EQ(*moved.get(), 7);
+}
+
+TEST(Test_cslibs_utility, threadPoolExecute) {
+  std::atomic<int> done(0);
+  {
+    cc::thread_pool pool(3);
+    /// tasks spawning tasks end up on the worker's own deque and are stolen
+    for (int i = 0; i < 10; ++i) {
+      pool.execute([&pool, &done]() {
+        for (int j = 0; j < 100; ++j)
+          pool.execute([&done]() { done.fetch_add(1); });
+      });
+    }
+  }
+  /// the destructor runs all pending tasks
+  EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(Test_cslibs_utility, threadPoolParallelFor) {
+  cc::thread_pool pool(4);
+  std::vector<int> values(10007, 0);
+  pool.parallel_for(0, values.size(), [&values](std::size_t i) { values[i] += static_cast<int>(i); });
+  for (std::size_t i = 0; i < values.size(); ++i) ASSERT_EQ(values[i], static_cast<int>(i));
+
+  std::atomic<std::size_t> sum(0);
+  pool.parallel_chunks(10, 1010, [&sum](std::size_t first, std::size_t last) {
+    EXPECT_LE(last - first, 7ul);
+    for (std::size_t i = first; i < last; ++i) sum.fetch_add(i);
+  }, 7);
+  EXPECT_EQ(sum.load(), 509500ul);
+
+  std::size_t calls = 0;
+  pool.parallel_for(5, 5, [&calls](std::size_t) { ++calls; });
+  EXPECT_EQ(calls, 0ul);
+
+  EXPECT_THROW(pool.parallel_for(0, 100, [](std::size_t i) {
+    if (i == 42) throw std::runtime_error("index");
+  }), std::runtime_error);
+}
+
+TEST(Test_cslibs_utility, threadPoolNested) {
+  cc::thread_pool pool(2);
+  std::atomic<std::size_t> count(0);
+  /// every worker blocks in an inner loop, which has to be completed by
+  /// helping instead of waiting
+  pool.parallel_for(0, 16, [&pool, &count](std::size_t) {
+    pool.parallel_for(0, 64, [&count](std::size_t) { count.fetch_add(1); }, 1);
+  }, 1);
+  EXPECT_EQ(count.load(), 16ul * 64ul);
+
+  std::future<std::size_t> nested = pool.submit([&pool]() {
+    std::atomic<std::size_t> n(0);
+    pool.parallel_for(0, 1000, [&n](std::size_t) { n.fetch_add(1); });
+    return n.load();
+  });
+  EXPECT_EQ(nested.get(), 1000ul);
+}
+
+TEST(Test_cslibs_utility, threadPoolWaitersSleep) {
+  cc::thread_pool pool(4);
+  /// the caller and three workers wait for the one sleeping chunk
+  const std::clock_t cpu = std::clock();
+  const auto wall = std::chrono::steady_clock::now();
+  pool.parallel_for(0, 2, [](std::size_t i) {
+    if (i == 1) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }, 1);
+  const double cpu_s = static_cast<double>(std::clock() - cpu) / CLOCKS_PER_SEC;
+  const double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall).count();
+  EXPECT_GE(wall_s, 0.1);
+  EXPECT_LT(cpu_s, 0.5 * wall_s);
+}
+
+TEST(Test_cslibs_utility, threadPoolAffinity) {
+  cc::thread_pool pool(2, {0});
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 10; ++i) futures.emplace_back(pool.submit([i]() { return i; }));
+  int sum = 0;
+  for (auto &f : futures) sum += f.get();
+  EXPECT_EQ(sum, 45);
+  EXPECT_GT(cc::thread_pool::global().size(), 0ul);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <cslibs_utility/synchronized/seqlock.hpp>
+#include <cslibs_utility/synchronized/shared_wrap_around.hpp>
+#include <cslibs_utility/synchronized/wrap_around.hpp>
+
+namespace cs = cslibs_utility::synchronized;
+
+namespace {
+/**
+ * @brief Probe a lock from another thread, the calling thread may own it.
+ */
+template <typename Function>
+bool probe(Function &&f) {
+  bool result = false;
+  std::thread t([&]() { result = f(); });
+  t.join();
+  return result;
+}
+}  // namespace
+
+TEST(Test_cslibs_utility, wrapAroundMove) {
+  std::mutex mutex;
+  int value = 0;
+  {
+    cs::WrapAround<int> a(&value, &mutex);
+    cs::WrapAround<int> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    b.data() = 1;
+
+    cs::WrapAround<int> c;
+    c = std::move(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_FALSE(probe([&mutex]() {
+      return mutex.try_lock() ? (mutex.unlock(), true) : false;
+    }));
+  }
+  // the mutex was unlocked exactly once
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+  EXPECT_EQ(value, 1);
+}
+
+TEST(Test_cslibs_utility, sharedWrapAround) {
+  std::shared_mutex mutex;
+  std::map<int, int> map{{1, 2}};
+  {
+    cs::SharedWrapAround<const std::map<int, int>> a(&map, &mutex);
+    cs::SharedWrapAround<const std::map<int, int>> b(&map, &mutex);
+    EXPECT_EQ(a->at(1), 2);
+    EXPECT_EQ(b.data().size(), 1ul);
+    EXPECT_FALSE(probe([&mutex]() {
+      return mutex.try_lock() ? (mutex.unlock(), true) : false;
+    }));
+    EXPECT_TRUE(probe([&mutex]() {
+      return mutex.try_lock_shared() ? (mutex.unlock_shared(), true) : false;
+    }));
+  }
+  {
+    cs::SharedWrapAround<std::map<int, int>> w(&map, &mutex);
+    w.data()[3] = 4;
+    EXPECT_FALSE(probe([&mutex]() {
+      return mutex.try_lock_shared() ? (mutex.unlock_shared(), true) : false;
+    }));
+  }
+  EXPECT_EQ(map.size(), 2ul);
+}
+
+namespace {
+struct Pose {
+  double x, y, theta;
+  long stamp;
+};
+}  // namespace
+
+TEST(Test_cslibs_utility, seqLock) {
+  cs::SeqLock<Pose> pose(Pose{0.0, 0.0, 0.0, 0});
+  std::atomic_bool stop(false);
+  std::atomic_bool consistent(true);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 2; ++i) {
+    readers.emplace_back([&]() {
+      while (!stop) {
+        const Pose p = pose.load();
+        const double s = static_cast<double>(p.stamp);
+        if (p.x != s || p.y != 2.0 * s || p.theta != 3.0 * s) {
+          consistent = false;
+        }
+      }
+    });
+  }
+  for (long i = 1; i <= 20000; ++i) {
+    const double s = static_cast<double>(i);
+    pose.store(Pose{s, 2.0 * s, 3.0 * s, i});
+  }
+  pose.modify([](Pose &p) { p.stamp = 0; p.x = p.y = p.theta = 0.0; });
+  stop = true;
+  for (auto &r : readers) {
+    r.join();
+  }
+  EXPECT_TRUE(consistent);
+  EXPECT_EQ(pose.load().stamp, 0);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}